@@ -0,0 +1,449 @@
+//
+//  Benchmark.cpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <Vizor/Application.hpp>
+
+#include <Vizor/Platform/HeadlessSurface.hpp>
+#include <Vizor/Platform/DeviceSelector.hpp>
+#include <Vizor/Platform/SurfaceDevice.hpp>
+#include <Vizor/Platform/SwapchainController.hpp>
+#include <Vizor/Platform/FramePresenter.hpp>
+#include <Vizor/Platform/PresentBatch.hpp>
+#include <Vizor/Platform/OffscreenController.hpp>
+#include <Vizor/Platform/FrameReadback.hpp>
+#include <Vizor/Platform/FrameTrace.hpp>
+
+#include <Logger/Console.hpp>
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		using namespace Logger;
+		
+		typedef std::chrono::steady_clock Clock;
+		
+		static double milliseconds_since(Clock::time_point start)
+		{
+			return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+		}
+		
+		static double milliseconds(std::uint64_t nanoseconds)
+		{
+			return nanoseconds / 1e6;
+		}
+		
+#if defined(VK_EXT_headless_surface)
+		class BenchmarkApplication : public Vizor::Application
+		{
+		public:
+			using Vizor::Application::Application;
+			virtual ~BenchmarkApplication() {}
+			
+			virtual void prepare(Layers & layers, Extensions & extensions) const noexcept override
+			{
+				Vizor::Application::prepare(layers, extensions);
+				
+				for (auto extension : HeadlessSurface::instance_extensions()) {
+					extensions.push_back(extension);
+				}
+			}
+			
+			// The API version the instance is created with, which limits the features any device can use. Must be set before the instance is created.
+			std::uint32_t api_version() const noexcept {return _api_version;}
+			void set_api_version(std::uint32_t api_version) noexcept {_api_version = api_version;}
+			
+		protected:
+			using Vizor::Application::setup_instance;
+			
+			virtual void setup_instance(vk::InstanceCreateInfo & instance_create_info) override
+			{
+				auto application_info = instance_create_info.pApplicationInfo ? *instance_create_info.pApplicationInfo : vk::ApplicationInfo();
+				application_info.setApiVersion(_api_version);
+				
+				instance_create_info.setPApplicationInfo(&application_info);
+				
+				Vizor::Application::setup_instance(instance_create_info);
+			}
+			
+			std::uint32_t _api_version = VK_API_VERSION_1_0;
+		};
+		
+		struct Options
+		{
+			std::size_t frames = 600;
+			std::size_t recreates = 50;
+			vk::Extent2D extent = {1280, 720};
+			vk::Extent2D readback_extent = {1920, 1080};
+			
+			// The API version to create the instance with, e.g. 1.2. Timeline synchronisation is only benchmarked from 1.2.
+			std::uint32_t instance_api_version = VK_API_VERSION_1_0;
+			
+			// A headless surface should never skip frames, so a run of skips means the loop would never finish.
+			std::size_t maximum_skips = 100;
+		};
+		
+		// Abort the run rather than spinning forever on a surface which can't be presented to.
+		static void check_progress(const FramePresenter & frame_presenter, std::size_t consecutive_skips, const Options & options)
+		{
+			if (frame_presenter.status() == FramePresenter::Status::SURFACE_LOST) {
+				throw std::runtime_error("Surface was lost!");
+			}
+			
+			if (consecutive_skips >= options.maximum_skips) {
+				throw std::runtime_error("Giving up after " + std::to_string(consecutive_skips) + " consecutive frames were skipped!");
+			}
+		}
+		
+		// Transition the acquired image for presentation, which is the least work a frame can do.
+		static void record_frame(SwapchainController & swapchain_controller, FramePresenter::Frame & frame)
+		{
+			auto & commands = frame.command_buffer;
+			
+			commands.begin(vk::CommandBufferBeginInfo().setFlags(vk::CommandBufferUsageFlagBits::eOneTimeSubmit));
+			
+			auto barrier = vk::ImageMemoryBarrier()
+				.setOldLayout(vk::ImageLayout::eUndefined)
+				.setNewLayout(vk::ImageLayout::ePresentSrcKHR)
+				.setSrcQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
+				.setDstQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
+				.setImage(swapchain_controller.buffers()[frame.image_index].image)
+				.setSubresourceRange(vk::ImageSubresourceRange(vk::ImageAspectFlagBits::eColor, 0, 1, 0, 1));
+			
+			commands.pipelineBarrier(vk::PipelineStageFlagBits::eColorAttachmentOutput, vk::PipelineStageFlagBits::eBottomOfPipe, vk::DependencyFlags(), nullptr, nullptr, {barrier});
+			
+			commands.end();
+		}
+		
+		// Sustained acquire, submit and present throughput for one present mode, number of frames in flight and synchronisation.
+		static void benchmark_presentation(std::ostream & output, SurfaceDevice & surface_device, SwapchainController::QueueFamilyIndices queue_family_indices, const Options & options, vk::PresentModeKHR present_mode, std::size_t frames_in_flight, FramePresenter::Synchronisation synchronisation)
+		{
+			SwapchainController swapchain_controller(surface_device.context(), queue_family_indices, options.extent, PresentPolicy(present_mode));
+			FramePresenter frame_presenter(swapchain_controller, surface_device.enabled_features(), frames_in_flight, synchronisation);
+			
+			// Allow the capacity to hold every frame along with the other spans the presenter records:
+			FrameTrace frame_trace(options.frames * 8);
+			frame_presenter.set_trace(&frame_trace);
+			
+			std::size_t presented = 0, skipped = 0, consecutive_skips = 0;
+			auto start = Clock::now();
+			
+			while (presented < options.frames) {
+				if (auto frame = frame_presenter.acquire()) {
+					record_frame(swapchain_controller, *frame);
+					frame_presenter.present(*frame);
+					
+					presented += 1;
+					consecutive_skips = 0;
+				} else {
+					skipped += 1;
+					consecutive_skips += 1;
+				}
+				
+				check_progress(frame_presenter, consecutive_skips, options);
+			}
+			
+			frame_presenter.wait();
+			
+			auto duration = milliseconds_since(start);
+			
+			output << "{\"present_mode\":\"" << vk::to_string(present_mode) << "\"";
+			output << ",\"frames_in_flight\":" << frames_in_flight;
+			output << ",\"synchronisation\":\"" << (synchronisation == FramePresenter::Synchronisation::TIMELINE ? "timeline" : "fences") << "\"";
+			output << ",\"frames\":" << presented;
+			output << ",\"skipped\":" << skipped;
+			output << ",\"frames_per_second\":" << (presented * 1000.0 / duration);
+			output << ",\"frame_time_p50_ms\":" << milliseconds(frame_trace.percentile("frame", 0.5));
+			output << ",\"frame_time_p99_ms\":" << milliseconds(frame_trace.percentile("frame", 0.99));
+			output << ",\"acquire_p99_ms\":" << milliseconds(frame_trace.percentile("acquire", 0.99));
+			output << ",\"present_p99_ms\":" << milliseconds(frame_trace.percentile("present", 0.99));
+			output << "}";
+		}
+		
+		// Two swapchains sharing one device, e.g. two windows, presented together with a single present per frame.
+		static void benchmark_multiple_surfaces(std::ostream & output, SurfaceDevice & surface_device, Surface & first, Surface & second, SwapchainController::QueueFamilyIndices queue_family_indices, const Options & options)
+		{
+			SwapchainController first_controller(surface_device.context(first), queue_family_indices, options.extent);
+			SwapchainController second_controller(surface_device.context(second), queue_family_indices, options.extent);
+			
+			FramePresenter first_presenter(first_controller);
+			FramePresenter second_presenter(second_controller);
+			
+			PresentBatch present_batch;
+			
+			std::size_t presented = 0, skipped = 0, consecutive_skips = 0;
+			auto start = Clock::now();
+			
+			while (presented < options.frames) {
+				for (auto target : {std::make_pair(&first_controller, &first_presenter), std::make_pair(&second_controller, &second_presenter)}) {
+					if (auto frame = target.second->acquire()) {
+						record_frame(*target.first, *frame);
+						present_batch.submit(*target.second, *frame);
+					} else {
+						skipped += 1;
+					}
+				}
+				
+				if (present_batch.size() == 2) {
+					presented += 1;
+					consecutive_skips = 0;
+				} else {
+					consecutive_skips += 1;
+				}
+				
+				present_batch.present();
+				
+				check_progress(first_presenter, consecutive_skips, options);
+				check_progress(second_presenter, consecutive_skips, options);
+			}
+			
+			first_presenter.wait();
+			second_presenter.wait();
+			
+			auto duration = milliseconds_since(start);
+			
+			output << "{\"surfaces\":2";
+			output << ",\"frames\":" << presented;
+			output << ",\"skipped\":" << skipped;
+			output << ",\"frames_per_second\":" << (presented * 1000.0 / duration);
+			output << "}";
+		}
+		
+		// Sustained throughput while reading back every frame from an offscreen target, which should be no slower than rendering alone.
+		static void benchmark_readback(std::ostream & output, SurfaceDevice & surface_device, const Options & options)
+		{
+			OffscreenController offscreen_controller(surface_device.context(), surface_device.graphics_queue(), surface_device.graphics_queue_family_index(), options.readback_extent, 3, vk::Format::eB8G8R8A8Unorm, vk::ImageUsageFlagBits::eColorAttachment | vk::ImageUsageFlagBits::eTransferSrc, surface_device.api_version());
+			FramePresenter frame_presenter(offscreen_controller);
+			
+			FrameTrace frame_trace(options.frames * 8);
+			frame_presenter.set_trace(&frame_trace);
+			
+			// Touch every capture, as a consumer would:
+			std::uint64_t checksum = 0;
+			
+			FrameReadback frame_readback(surface_device.context(), [&](const FrameReadback::Capture & capture){
+				checksum += static_cast<const std::uint8_t *>(capture.data)[capture.size - 1];
+			}, frame_presenter.frames_in_flight() + 2);
+			
+			std::size_t presented = 0, consecutive_skips = 0;
+			auto start = Clock::now();
+			
+			while (presented < options.frames) {
+				if (auto frame = frame_presenter.acquire()) {
+					auto & commands = frame->command_buffer;
+					
+					commands.begin(vk::CommandBufferBeginInfo().setFlags(vk::CommandBufferUsageFlagBits::eOneTimeSubmit));
+					
+					auto barrier = vk::ImageMemoryBarrier()
+						.setOldLayout(vk::ImageLayout::eUndefined)
+						.setNewLayout(vk::ImageLayout::eTransferSrcOptimal)
+						.setSrcQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
+						.setDstQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
+						.setImage(offscreen_controller.buffers()[frame->image_index].image)
+						.setSubresourceRange(vk::ImageSubresourceRange(vk::ImageAspectFlagBits::eColor, 0, 1, 0, 1));
+					
+					commands.pipelineBarrier(vk::PipelineStageFlagBits::eTopOfPipe, vk::PipelineStageFlagBits::eColorAttachmentOutput, vk::DependencyFlags(), nullptr, nullptr, {barrier});
+					
+					frame_readback.record(frame_presenter, *frame, vk::ImageLayout::eTransferSrcOptimal);
+					
+					commands.end();
+					
+					frame_presenter.present(*frame);
+					
+					presented += 1;
+					consecutive_skips = 0;
+				} else {
+					consecutive_skips += 1;
+				}
+				
+				check_progress(frame_presenter, consecutive_skips, options);
+			}
+			
+			frame_presenter.wait();
+			frame_readback.collect(frame_presenter.serial());
+			
+			auto duration = milliseconds_since(start);
+			
+			output << "{\"width\":" << options.readback_extent.width;
+			output << ",\"height\":" << options.readback_extent.height;
+			output << ",\"frames\":" << presented;
+			output << ",\"captured\":" << frame_readback.delivered();
+			output << ",\"dropped\":" << frame_readback.dropped();
+			output << ",\"frames_per_second\":" << (presented * 1000.0 / duration);
+			output << ",\"frame_time_p99_ms\":" << milliseconds(frame_trace.percentile("frame", 0.99));
+			output << ",\"checksum\":" << checksum;
+			output << "}";
+		}
+		
+		// The time taken to recreate the swapchain, alternating between two extents so that every resize creates a new swapchain.
+		static void benchmark_recreate(std::ostream & output, SurfaceDevice & surface_device, SwapchainController::QueueFamilyIndices queue_family_indices, const Options & options)
+		{
+			SwapchainController swapchain_controller(surface_device.context(), queue_family_indices, options.extent);
+			swapchain_controller.swapchain();
+			
+			FrameTrace frame_trace(options.recreates);
+			
+			for (std::size_t index = 0; index < options.recreates; index += 1) {
+				auto extent = options.extent;
+				extent.width += index % 2;
+				
+				{
+					FrameTrace::Scope scope(&frame_trace, "recreate", index);
+					swapchain_controller.resize(extent);
+				}
+				
+				// Nothing is in flight, so the old swapchain can be released straight away:
+				swapchain_controller.retirement_queue().clear();
+			}
+			
+			output << "{\"count\":" << options.recreates;
+			output << ",\"p50_ms\":" << milliseconds(frame_trace.percentile("recreate", 0.5));
+			output << ",\"p99_ms\":" << milliseconds(frame_trace.percentile("recreate", 0.99));
+			output << "}";
+		}
+		
+		static Options parse(int argc, char ** argv)
+		{
+			Options options;
+			
+			for (int index = 1; index < argc; index += 2) {
+				// Every option takes a value, so a trailing option is a mistake rather than something to ignore:
+				if (index + 1 == argc) {
+					throw std::invalid_argument(std::string("Option ") + argv[index] + " requires a value!");
+				}
+				
+				if (std::strcmp(argv[index], "--frames") == 0) {
+					options.frames = std::stoul(argv[index + 1]);
+				} else if (std::strcmp(argv[index], "--recreates") == 0) {
+					options.recreates = std::stoul(argv[index + 1]);
+				} else if (std::strcmp(argv[index], "--width") == 0) {
+					options.extent.width = std::stoul(argv[index + 1]);
+				} else if (std::strcmp(argv[index], "--height") == 0) {
+					options.extent.height = std::stoul(argv[index + 1]);
+				} else if (std::strcmp(argv[index], "--maximum-skips") == 0) {
+					options.maximum_skips = std::stoul(argv[index + 1]);
+				} else if (std::strcmp(argv[index], "--api-version") == 0) {
+					std::size_t offset = 0;
+					auto major = std::stoul(argv[index + 1], &offset);
+					auto minor = argv[index + 1][offset] == '.' ? std::stoul(argv[index + 1] + offset + 1) : 0;
+					
+					options.instance_api_version = VK_MAKE_VERSION(major, minor, 0);
+				} else {
+					throw std::invalid_argument(std::string("Unknown option ") + argv[index] + "!");
+				}
+			}
+			
+			return options;
+		}
+		
+		static void benchmark(std::ostream & output, const Options & options)
+		{
+			auto start = Clock::now();
+			BenchmarkApplication application;
+			application.set_api_version(options.instance_api_version);
+			auto context = application.context();
+			auto instance_time = milliseconds_since(start);
+			
+			start = Clock::now();
+			HeadlessSurface surface(context);
+			surface.surface();
+			auto surface_time = milliseconds_since(start);
+			
+			// A second surface on the same device, as a second window would be:
+			HeadlessSurface second_surface(context);
+			
+			start = Clock::now();
+			DeviceSelector device_selector(context, surface);
+			device_selector.set_instance_api_version(application.api_version());
+			
+			DeviceFeatures optional_features;
+#if defined(VK_VERSION_1_2)
+			optional_features.vulkan12.setTimelineSemaphore(true);
+#endif
+			
+			SurfaceDevice surface_device(device_selector.select(), surface);
+			surface_device.add_target(second_surface);
+			surface_device.set_instance_api_version(application.api_version());
+			surface_device.request_features(DeviceFeatures(), optional_features);
+			surface_device.context();
+			auto device_time = milliseconds_since(start);
+			
+			SwapchainController::QueueFamilyIndices queue_family_indices = {
+				surface_device.graphics_queue_family_index(),
+				surface_device.present_queue_family_index(),
+			};
+			
+			auto physical_device = surface_device.physical_device();
+			
+			output << "{\"device\":\"" << physical_device.getProperties().deviceName << "\"";
+			output << ",\"surface\":\"headless\"";
+			output << ",\"instance_creation_ms\":" << instance_time;
+			output << ",\"surface_creation_ms\":" << surface_time;
+			output << ",\"device_creation_ms\":" << device_time;
+			
+			output << ",\"swapchain_recreate\":";
+			benchmark_recreate(output, surface_device, queue_family_indices, options);
+			
+			output << ",\"multiple_surfaces\":";
+			benchmark_multiple_surfaces(output, surface_device, surface, second_surface, queue_family_indices, options);
+			
+			output << ",\"readback\":";
+			benchmark_readback(output, surface_device, options);
+			
+			output << ",\"presentation\":[";
+			
+			bool first = true;
+			
+			for (auto synchronisation : {FramePresenter::Synchronisation::FENCES, FramePresenter::Synchronisation::TIMELINE}) {
+				if (!FramePresenter::supports(synchronisation, surface_device.enabled_features())) {
+					Console::warn("Skipping timeline synchronisation, which requires --api-version 1.2 and the timelineSemaphore feature.");
+					continue;
+				}
+				
+				for (auto present_mode : physical_device.getSurfacePresentModesKHR(surface.surface())) {
+					for (std::size_t frames_in_flight = 1; frames_in_flight <= 3; frames_in_flight += 1) {
+						Console::info("Benchmarking", vk::to_string(present_mode), "with", frames_in_flight, "frames in flight...");
+						
+						if (!first) output << ",";
+						first = false;
+						
+						benchmark_presentation(output, surface_device, queue_family_indices, options, present_mode, frames_in_flight, synchronisation);
+					}
+				}
+			}
+			
+			output << "]}" << std::endl;
+		}
+#endif
+	}
+}
+
+int main(int argc, char ** argv)
+{
+	using namespace Vizor::Platform;
+	
+#if defined(VK_EXT_headless_surface)
+	try {
+		benchmark(std::cout, parse(argc, argv));
+	} catch (std::exception & error) {
+		Logger::Console::error(error.what());
+		return 1;
+	}
+	
+	return 0;
+#else
+	Logger::Console::error("The benchmark requires VK_EXT_headless_surface!");
+	return 1;
+#endif
+}
@@ -0,0 +1,327 @@
+//
+//  DeviceFeatures.cpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "DeviceFeatures.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		// vk::PhysicalDeviceFeatures is nothing but booleans, in this order:
+		static const char * const CORE_FEATURES[] = {
+			"robustBufferAccess",
+			"fullDrawIndexUint32",
+			"imageCubeArray",
+			"independentBlend",
+			"geometryShader",
+			"tessellationShader",
+			"sampleRateShading",
+			"dualSrcBlend",
+			"logicOp",
+			"multiDrawIndirect",
+			"drawIndirectFirstInstance",
+			"depthClamp",
+			"depthBiasClamp",
+			"fillModeNonSolid",
+			"depthBounds",
+			"wideLines",
+			"largePoints",
+			"alphaToOne",
+			"multiViewport",
+			"samplerAnisotropy",
+			"textureCompressionETC2",
+			"textureCompressionASTC_LDR",
+			"textureCompressionBC",
+			"occlusionQueryPrecise",
+			"pipelineStatisticsQuery",
+			"vertexPipelineStoresAndAtomics",
+			"fragmentStoresAndAtomics",
+			"shaderTessellationAndGeometryPointSize",
+			"shaderImageGatherExtended",
+			"shaderStorageImageExtendedFormats",
+			"shaderStorageImageMultisample",
+			"shaderStorageImageReadWithoutFormat",
+			"shaderStorageImageWriteWithoutFormat",
+			"shaderUniformBufferArrayDynamicIndexing",
+			"shaderSampledImageArrayDynamicIndexing",
+			"shaderStorageBufferArrayDynamicIndexing",
+			"shaderStorageImageArrayDynamicIndexing",
+			"shaderClipDistance",
+			"shaderCullDistance",
+			"shaderFloat64",
+			"shaderInt64",
+			"shaderInt16",
+			"shaderResourceResidency",
+			"shaderResourceMinLod",
+			"sparseBinding",
+			"sparseResidencyBuffer",
+			"sparseResidencyImage2D",
+			"sparseResidencyImage3D",
+			"sparseResidency2Samples",
+			"sparseResidency4Samples",
+			"sparseResidency8Samples",
+			"sparseResidency16Samples",
+			"sparseResidencyAliased",
+			"variableMultisampleRate",
+			"inheritedQueries",
+		};
+		
+		static_assert(sizeof(vk::PhysicalDeviceFeatures) == sizeof(CORE_FEATURES) / sizeof(*CORE_FEATURES) * sizeof(vk::Bool32), "Unexpected layout of vk::PhysicalDeviceFeatures!");
+		
+#if defined(VK_VERSION_1_2)
+		// The extended structures are a header (sType and pNext) followed by booleans, in this order:
+		static const char * const VULKAN11_FEATURES[] = {
+			"storageBuffer16BitAccess",
+			"uniformAndStorageBuffer16BitAccess",
+			"storagePushConstant16",
+			"storageInputOutput16",
+			"multiview",
+			"multiviewGeometryShader",
+			"multiviewTessellationShader",
+			"variablePointersStorageBuffer",
+			"variablePointers",
+			"protectedMemory",
+			"samplerYcbcrConversion",
+			"shaderDrawParameters",
+		};
+		
+		static const char * const VULKAN12_FEATURES[] = {
+			"samplerMirrorClampToEdge",
+			"drawIndirectCount",
+			"storageBuffer8BitAccess",
+			"uniformAndStorageBuffer8BitAccess",
+			"storagePushConstant8",
+			"shaderBufferInt64Atomics",
+			"shaderSharedInt64Atomics",
+			"shaderFloat16",
+			"shaderInt8",
+			"descriptorIndexing",
+			"shaderInputAttachmentArrayDynamicIndexing",
+			"shaderUniformTexelBufferArrayDynamicIndexing",
+			"shaderStorageTexelBufferArrayDynamicIndexing",
+			"shaderUniformBufferArrayNonUniformIndexing",
+			"shaderSampledImageArrayNonUniformIndexing",
+			"shaderStorageBufferArrayNonUniformIndexing",
+			"shaderStorageImageArrayNonUniformIndexing",
+			"shaderInputAttachmentArrayNonUniformIndexing",
+			"shaderUniformTexelBufferArrayNonUniformIndexing",
+			"shaderStorageTexelBufferArrayNonUniformIndexing",
+			"descriptorBindingUniformBufferUpdateAfterBind",
+			"descriptorBindingSampledImageUpdateAfterBind",
+			"descriptorBindingStorageImageUpdateAfterBind",
+			"descriptorBindingStorageBufferUpdateAfterBind",
+			"descriptorBindingUniformTexelBufferUpdateAfterBind",
+			"descriptorBindingStorageTexelBufferUpdateAfterBind",
+			"descriptorBindingUpdateUnusedWhilePending",
+			"descriptorBindingPartiallyBound",
+			"descriptorBindingVariableDescriptorCount",
+			"runtimeDescriptorArray",
+			"samplerFilterMinmax",
+			"scalarBlockLayout",
+			"imagelessFramebuffer",
+			"uniformBufferStandardLayout",
+			"shaderSubgroupExtendedTypes",
+			"separateDepthStencilLayouts",
+			"hostQueryReset",
+			"timelineSemaphore",
+			"bufferDeviceAddress",
+			"bufferDeviceAddressCaptureReplay",
+			"bufferDeviceAddressMultiDevice",
+			"vulkanMemoryModel",
+			"vulkanMemoryModelDeviceScope",
+			"vulkanMemoryModelAvailabilityVisibilityChains",
+			"shaderOutputViewportIndex",
+			"shaderOutputLayer",
+			"subgroupBroadcastDynamicId",
+		};
+#endif
+		
+#if defined(VK_VERSION_1_3)
+		static const char * const VULKAN13_FEATURES[] = {
+			"robustImageAccess",
+			"inlineUniformBlock",
+			"descriptorBindingInlineUniformBlockUpdateAfterBind",
+			"pipelineCreationCacheControl",
+			"privateData",
+			"shaderDemoteToHelperInvocation",
+			"shaderTerminateInvocation",
+			"subgroupSizeControl",
+			"computeFullSubgroups",
+			"synchronization2",
+			"textureCompressionASTC_HDR",
+			"shaderZeroInitializeWorkgroupMemory",
+			"dynamicRendering",
+			"shaderIntegerDotProduct",
+			"maintenance4",
+		};
+#endif
+		
+		template <typename StructureT, std::size_t COUNT>
+		static vk::Bool32 * first_feature(StructureT & structure, const char * const (&)[COUNT], std::size_t offset, std::size_t end)
+		{
+			// Padding at the end of the structure is not a feature, so check against the offset of the last member rather than the size:
+			static_assert(sizeof(StructureT) >= COUNT * sizeof(vk::Bool32), "Unexpected feature structure layout!");
+			
+			if (end - offset != COUNT * sizeof(vk::Bool32)) {
+				throw std::logic_error("Unexpected feature structure layout!");
+			}
+			
+			return reinterpret_cast<vk::Bool32 *>(reinterpret_cast<std::uint8_t *>(&structure) + offset);
+		}
+		
+		std::vector<DeviceFeatures::Group> DeviceFeatures::groups() const
+		{
+			// The groups are used to read and write the features, so we cast away constness here once rather than in every caller:
+			auto & self = const_cast<DeviceFeatures &>(*this);
+			
+			std::vector<Group> groups = {
+				{"", CORE_FEATURES, std::size(CORE_FEATURES), reinterpret_cast<vk::Bool32 *>(&self.core)},
+			};
+			
+#if defined(VK_VERSION_1_2)
+			groups.push_back({"Vulkan 1.1: ", VULKAN11_FEATURES, std::size(VULKAN11_FEATURES),
+				first_feature(self.vulkan11, VULKAN11_FEATURES, offsetof(VkPhysicalDeviceVulkan11Features, storageBuffer16BitAccess), offsetof(VkPhysicalDeviceVulkan11Features, shaderDrawParameters) + sizeof(VkBool32))
+			});
+			
+			groups.push_back({"Vulkan 1.2: ", VULKAN12_FEATURES, std::size(VULKAN12_FEATURES),
+				first_feature(self.vulkan12, VULKAN12_FEATURES, offsetof(VkPhysicalDeviceVulkan12Features, samplerMirrorClampToEdge), offsetof(VkPhysicalDeviceVulkan12Features, subgroupBroadcastDynamicId) + sizeof(VkBool32))
+			});
+#endif
+			
+#if defined(VK_VERSION_1_3)
+			groups.push_back({"Vulkan 1.3: ", VULKAN13_FEATURES, std::size(VULKAN13_FEATURES),
+				first_feature(self.vulkan13, VULKAN13_FEATURES, offsetof(VkPhysicalDeviceVulkan13Features, robustImageAccess), offsetof(VkPhysicalDeviceVulkan13Features, maintenance4) + sizeof(VkBool32))
+			});
+#endif
+			
+			return groups;
+		}
+		
+		std::uint32_t DeviceFeatures::effective_api_version(vk::PhysicalDevice physical_device, std::uint32_t instance_api_version)
+		{
+			// Only the major and minor versions matter, and the device version includes the driver's patch version:
+			auto device_api_version = physical_device.getProperties().apiVersion;
+			
+			return std::min(VK_MAKE_VERSION(VK_VERSION_MAJOR(device_api_version), VK_VERSION_MINOR(device_api_version), 0), VK_MAKE_VERSION(VK_VERSION_MAJOR(instance_api_version), VK_VERSION_MINOR(instance_api_version), 0));
+		}
+		
+		DeviceFeatures DeviceFeatures::supported_by(vk::PhysicalDevice physical_device, std::uint32_t api_version)
+		{
+			DeviceFeatures features;
+			
+#if defined(VK_VERSION_1_2)
+			if (api_version >= VK_API_VERSION_1_2) {
+				auto features2 = features.chain(api_version);
+				physical_device.getFeatures2(&features2);
+				features.core = features2.features;
+				
+				return features;
+			}
+#endif
+			
+			features.core = physical_device.getFeatures();
+			
+			return features;
+		}
+		
+		bool DeviceFeatures::empty() const
+		{
+			for (auto & group : groups()) {
+				for (std::size_t index = 0; index < group.count; index += 1) {
+					if (group.values[index]) return false;
+				}
+			}
+			
+			return true;
+		}
+		
+		std::vector<std::string> DeviceFeatures::missing_from(const DeviceFeatures & available) const
+		{
+			std::vector<std::string> missing;
+			
+			auto groups = this->groups(), available_groups = available.groups();
+			
+			for (std::size_t group = 0; group < groups.size(); group += 1) {
+				for (std::size_t index = 0; index < groups[group].count; index += 1) {
+					if (groups[group].values[index] && !available_groups[group].values[index]) {
+						missing.push_back(std::string(groups[group].prefix) + groups[group].names[index]);
+					}
+				}
+			}
+			
+			return missing;
+		}
+		
+		DeviceFeatures DeviceFeatures::operator&(const DeviceFeatures & other) const
+		{
+			DeviceFeatures result;
+			
+			auto groups = this->groups(), other_groups = other.groups(), result_groups = result.groups();
+			
+			for (std::size_t group = 0; group < groups.size(); group += 1) {
+				for (std::size_t index = 0; index < groups[group].count; index += 1) {
+					result_groups[group].values[index] = groups[group].values[index] && other_groups[group].values[index];
+				}
+			}
+			
+			return result;
+		}
+		
+		DeviceFeatures DeviceFeatures::operator|(const DeviceFeatures & other) const
+		{
+			DeviceFeatures result;
+			
+			auto groups = this->groups(), other_groups = other.groups(), result_groups = result.groups();
+			
+			for (std::size_t group = 0; group < groups.size(); group += 1) {
+				for (std::size_t index = 0; index < groups[group].count; index += 1) {
+					result_groups[group].values[index] = groups[group].values[index] || other_groups[group].values[index];
+				}
+			}
+			
+			return result;
+		}
+		
+		vk::PhysicalDeviceFeatures2 DeviceFeatures::chain(std::uint32_t api_version)
+		{
+			auto features2 = vk::PhysicalDeviceFeatures2()
+				.setFeatures(core);
+			
+#if defined(VK_VERSION_1_2)
+			void ** next = &features2.pNext;
+			
+			vulkan11.pNext = nullptr;
+			vulkan12.pNext = nullptr;
+			
+			if (api_version >= VK_API_VERSION_1_2) {
+				*next = &vulkan11;
+				next = &vulkan11.pNext;
+				
+				*next = &vulkan12;
+				next = &vulkan12.pNext;
+			}
+			
+#if defined(VK_VERSION_1_3)
+			vulkan13.pNext = nullptr;
+			
+			if (api_version >= VK_API_VERSION_1_3) {
+				*next = &vulkan13;
+				next = &vulkan13.pNext;
+			}
+#endif
+#endif
+			
+			return features2;
+		}
+	}
+}
@@ -0,0 +1,71 @@
+//
+//  DeviceFeatures.hpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include <Vizor/Context.hpp>
+
+#include <string>
+#include <vector>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		// A set of device features, including the Vulkan 1.1, 1.2 and 1.3 feature structures where the headers provide them.
+		class DeviceFeatures
+		{
+		public:
+			DeviceFeatures() {}
+			
+			// The API version which device functionality may use: the lower of the version the instance was created with and the version the device supports.
+			static std::uint32_t effective_api_version(vk::PhysicalDevice physical_device, std::uint32_t instance_api_version);
+			
+			// Everything the physical device supports. The extended structures are only queried if the effective API version supports them.
+			static DeviceFeatures supported_by(vk::PhysicalDevice physical_device, std::uint32_t api_version);
+			
+			vk::PhysicalDeviceFeatures core;
+			
+#if defined(VK_VERSION_1_2)
+			vk::PhysicalDeviceVulkan11Features vulkan11;
+			vk::PhysicalDeviceVulkan12Features vulkan12;
+#endif
+			
+#if defined(VK_VERSION_1_3)
+			vk::PhysicalDeviceVulkan13Features vulkan13;
+#endif
+			
+			// Whether no features are enabled at all.
+			bool empty() const;
+			
+			// The names of the features which are enabled here but not in the given features.
+			std::vector<std::string> missing_from(const DeviceFeatures & available) const;
+			
+			// The features enabled in both.
+			DeviceFeatures operator&(const DeviceFeatures & other) const;
+			
+			// The features enabled in either.
+			DeviceFeatures operator|(const DeviceFeatures & other) const;
+			
+			// Link the structures which the given effective API version supports into a chain for vk::DeviceCreateInfo::pNext. The chain points into this object, so it must not be moved or destroyed while the chain is in use.
+			vk::PhysicalDeviceFeatures2 chain(std::uint32_t api_version);
+			
+		private:
+			struct Group
+			{
+				const char * prefix;
+				const char * const * names;
+				std::size_t count;
+				vk::Bool32 * values;
+			};
+			
+			// Every feature as a flat array of booleans per structure, in the same order for every instance.
+			std::vector<Group> groups() const;
+		};
+	}
+}
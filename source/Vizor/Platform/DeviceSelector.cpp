@@ -0,0 +1,199 @@
+//
+//  DeviceSelector.cpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "DeviceSelector.hpp"
+
+#include <Logger/Console.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		using namespace Logger;
+		
+		static std::string lowercase(std::string string)
+		{
+			std::transform(string.begin(), string.end(), string.begin(), [](unsigned char character){return std::tolower(character);});
+			
+			return string;
+		}
+		
+		static std::uint64_t type_rank(vk::PhysicalDeviceType type)
+		{
+			switch (type) {
+				case vk::PhysicalDeviceType::eDiscreteGpu: return 4;
+				case vk::PhysicalDeviceType::eIntegratedGpu: return 3;
+				case vk::PhysicalDeviceType::eVirtualGpu: return 2;
+				case vk::PhysicalDeviceType::eCpu: return 1;
+				default: return 0;
+			}
+		}
+		
+		DeviceSelector::DeviceSelector(const Context & context, Surface & target) : Context(context), _target(target)
+		{
+		}
+		
+		DeviceSelector::~DeviceSelector()
+		{
+		}
+		
+		std::vector<DeviceSelector::Candidate> DeviceSelector::candidates()
+		{
+			std::vector<Candidate> candidates;
+			
+			for (auto physical_device : _instance.enumeratePhysicalDevices()) {
+				candidates.push_back(evaluate(physical_device));
+			}
+			
+			return candidates;
+		}
+		
+		DeviceSelector::Candidate DeviceSelector::evaluate(vk::PhysicalDevice physical_device)
+		{
+			Candidate candidate{physical_device, physical_device.getProperties(), 0};
+			
+			// A device which can't render, or present to the target, is no use no matter how fast it is. As with SurfaceDevice::setup_queues, presenting may use a different family to rendering:
+			auto surface = _target.surface();
+			auto queue_family_properties = physical_device.getQueueFamilyProperties();
+			bool can_render = false, can_present = false;
+			
+			for (std::size_t index = 0; index < queue_family_properties.size(); index += 1) {
+				if (queue_family_properties[index].queueCount == 0) continue;
+				
+				if (queue_family_properties[index].queueFlags & vk::QueueFlagBits::eGraphics) {
+					can_render = true;
+				}
+				
+				if (!can_present && physical_device.getSurfaceSupportKHR(index, surface)) {
+					can_present = true;
+				}
+			}
+			
+			if (!can_render) {
+				candidate.unsuitable = "no graphics queue";
+				return candidate;
+			}
+			
+			if (!can_present) {
+				candidate.unsuitable = "no queue can present to the surface";
+				return candidate;
+			}
+			
+			auto extension_properties = physical_device.enumerateDeviceExtensionProperties();
+			
+			for (auto extension : _required_extensions) {
+				auto supported = std::any_of(extension_properties.begin(), extension_properties.end(), [&](const vk::ExtensionProperties & properties){
+					return std::strcmp(properties.extensionName, extension) == 0;
+				});
+				
+				if (!supported) {
+					candidate.unsuitable = std::string("missing extension ") + extension;
+					return candidate;
+				}
+			}
+			
+			auto missing_features = _required_features.missing_from(DeviceFeatures::supported_by(physical_device, DeviceFeatures::effective_api_version(physical_device, _instance_api_version)));
+			
+			if (!missing_features.empty()) {
+				candidate.unsuitable = "missing feature " + missing_features.front();
+				return candidate;
+			}
+			
+			// The device type dominates, with device local memory (in MiB) breaking ties:
+			auto memory_properties = physical_device.getMemoryProperties();
+			std::uint64_t device_local_memory = 0;
+			
+			for (std::uint32_t index = 0; index < memory_properties.memoryHeapCount; index += 1) {
+				auto & heap = memory_properties.memoryHeaps[index];
+				
+				if (heap.flags & vk::MemoryHeapFlagBits::eDeviceLocal) {
+					device_local_memory += heap.size;
+				}
+			}
+			
+			candidate.score = (type_rank(candidate.properties.deviceType) << 32) + std::min<std::uint64_t>(device_local_memory >> 20, UINT32_MAX);
+			
+			return candidate;
+		}
+		
+		std::string DeviceSelector::preference() const
+		{
+			if (auto value = std::getenv(ENVIRONMENT_VARIABLE)) {
+				if (*value) return value;
+			}
+			
+			return _preference;
+		}
+		
+		PhysicalContext DeviceSelector::select()
+		{
+			auto candidates = this->candidates();
+			
+			for (std::size_t index = 0; index < candidates.size(); index += 1) {
+				auto & candidate = candidates[index];
+				
+				if (candidate.suitable()) {
+					Console::info("Device", index, candidate.properties.deviceName, vk::to_string(candidate.properties.deviceType), "score", candidate.score);
+				} else {
+					Console::info("Device", index, candidate.properties.deviceName, "is unsuitable:", candidate.unsuitable);
+				}
+			}
+			
+			const Candidate * selected = nullptr;
+			auto preference = this->preference();
+			
+			if (!preference.empty()) {
+				char * end = nullptr;
+				auto index = std::strtoul(preference.c_str(), &end, 10);
+				
+				if (*end == '\0') {
+					if (index < candidates.size()) {
+						selected = &candidates[index];
+					}
+				} else {
+					auto name = lowercase(preference);
+					
+					for (auto & candidate : candidates) {
+						if (lowercase(candidate.properties.deviceName).find(name) != std::string::npos) {
+							selected = &candidate;
+							break;
+						}
+					}
+				}
+				
+				if (!selected) {
+					throw std::runtime_error("Could not find preferred device " + preference + "!");
+				}
+				
+				// An explicit choice which can't work is an error, rather than silently using a different device:
+				if (!selected->suitable()) {
+					throw std::runtime_error(std::string("Preferred device ") + selected->properties.deviceName + " is unsuitable: " + selected->unsuitable + "!");
+				}
+			} else {
+				for (auto & candidate : candidates) {
+					if (candidate.suitable() && (!selected || candidate.score > selected->score)) {
+						selected = &candidate;
+					}
+				}
+				
+				if (!selected) {
+					throw std::runtime_error("Could not find a suitable device!");
+				}
+			}
+			
+			Console::info("Selected device", selected->properties.deviceName);
+			
+			return PhysicalContext(*this, selected->physical_device);
+		}
+	}
+}
@@ -0,0 +1,79 @@
+//
+//  DeviceSelector.hpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Surface.hpp"
+#include "DeviceFeatures.hpp"
+
+#include <Vizor/PhysicalContext.hpp>
+
+#include <string>
+#include <vector>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		// Chooses the physical device to present to a surface with, preferring discrete over integrated devices and then more device local memory.
+		class DeviceSelector : public Context
+		{
+		public:
+			// If set, selects a device by index or by (case insensitive) name, e.g. VIZOR_DEVICE=1 or VIZOR_DEVICE=nvidia.
+			static constexpr const char * ENVIRONMENT_VARIABLE = "VIZOR_DEVICE";
+			
+			DeviceSelector(const Context & context, Surface & target);
+			virtual ~DeviceSelector();
+			
+			struct Candidate
+			{
+				vk::PhysicalDevice physical_device;
+				vk::PhysicalDeviceProperties properties;
+				
+				// Higher is better. Only meaningful if the device is suitable.
+				std::uint64_t score;
+				
+				// Why the device can't be used, or empty if it can.
+				std::string unsuitable;
+				
+				bool suitable() const noexcept {return unsuitable.empty();}
+			};
+			
+			// Devices which don't support these are unsuitable.
+			void require_features(const DeviceFeatures & features) {_required_features = _required_features | features;}
+			void require_extension(const char * extension) {_required_extensions.push_back(extension);}
+			
+			// The API version the instance was created with, which limits the features that can be used on any device.
+			void set_instance_api_version(std::uint32_t instance_api_version) noexcept {_instance_api_version = instance_api_version;}
+			
+			// Select a device by index or name, as per ENVIRONMENT_VARIABLE, which takes precedence if it is set.
+			void set_preference(const std::string & preference) {_preference = preference;}
+			
+			// Every physical device, in enumeration order.
+			std::vector<Candidate> candidates();
+			
+			// The preferred device if one was given, otherwise the suitable device with the highest score. Throws if there is no suitable device.
+			PhysicalContext select();
+			
+		protected:
+			virtual Candidate evaluate(vk::PhysicalDevice physical_device);
+			
+			// The preference from the environment, or the one which was set.
+			std::string preference() const;
+			
+			Surface & _target;
+			
+			DeviceFeatures _required_features;
+			Extensions _required_extensions = {VK_KHR_SWAPCHAIN_EXTENSION_NAME};
+			
+			std::string _preference;
+			
+			std::uint32_t _instance_api_version = VK_API_VERSION_1_0;
+		};
+	}
+}
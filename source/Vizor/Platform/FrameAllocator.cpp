@@ -0,0 +1,99 @@
+//
+//  FrameAllocator.cpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "FrameAllocator.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		static vk::DeviceSize align(vk::DeviceSize offset, vk::DeviceSize alignment)
+		{
+			return (offset + alignment - 1) / alignment * alignment;
+		}
+		
+		FrameAllocator::FrameAllocator(const GraphicsContext & graphics_context, vk::DeviceSize capacity, std::size_t frames_in_flight, vk::BufferUsageFlags usage) : GraphicsContext(graphics_context), _frames_in_flight(frames_in_flight)
+		{
+			if (frames_in_flight == 0) {
+				throw std::invalid_argument("Frame allocator requires at least one frame in flight!");
+			}
+			
+			auto limits = _physical_device.getProperties().limits;
+			
+			if (usage & vk::BufferUsageFlagBits::eUniformBuffer) {
+				_alignment = std::max(_alignment, limits.minUniformBufferOffsetAlignment);
+			}
+			
+			if (usage & vk::BufferUsageFlagBits::eStorageBuffer) {
+				_alignment = std::max(_alignment, limits.minStorageBufferOffsetAlignment);
+			}
+			
+			// Each region starts on an aligned offset, so the first allocation of every frame is aligned too:
+			_capacity = align(capacity, _alignment);
+			
+			auto buffer_create_info = vk::BufferCreateInfo()
+				.setSize(_capacity * _frames_in_flight)
+				.setUsage(usage)
+				.setSharingMode(vk::SharingMode::eExclusive);
+			
+			_buffer = _device.createBufferUnique(buffer_create_info, _allocation_callbacks);
+			
+			auto memory_requirements = _device.getBufferMemoryRequirements(_buffer.get());
+			
+			auto memory_allocate_info = vk::MemoryAllocateInfo()
+				.setAllocationSize(memory_requirements.size)
+				.setMemoryTypeIndex(find_memory_type(memory_requirements.memoryTypeBits, vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent));
+			
+			_memory = _device.allocateMemoryUnique(memory_allocate_info, _allocation_callbacks);
+			_device.bindBufferMemory(_buffer.get(), _memory.get(), 0);
+			
+			// The memory stays mapped until it is freed:
+			_data = static_cast<std::uint8_t *>(_device.mapMemory(_memory.get(), 0, VK_WHOLE_SIZE));
+			
+			begin(0);
+		}
+		
+		FrameAllocator::~FrameAllocator()
+		{
+		}
+		
+		std::uint32_t FrameAllocator::find_memory_type(std::uint32_t memory_type_bits, vk::MemoryPropertyFlags properties) const
+		{
+			auto memory_properties = _physical_device.getMemoryProperties();
+			
+			for (std::uint32_t index = 0; index < memory_properties.memoryTypeCount; index += 1) {
+				if ((memory_type_bits & (1 << index)) && (memory_properties.memoryTypes[index].propertyFlags & properties) == properties) {
+					return index;
+				}
+			}
+			
+			throw std::runtime_error("Could not find host visible and coherent memory!");
+		}
+		
+		void FrameAllocator::begin(std::size_t frame_index)
+		{
+			_region_offset = _offset = (frame_index % _frames_in_flight) * _capacity;
+		}
+		
+		FrameAllocator::Allocation FrameAllocator::allocate(vk::DeviceSize size)
+		{
+			auto offset = align(_offset, _alignment);
+			
+			if (offset + size > _region_offset + _capacity) {
+				throw std::runtime_error("Frame allocator is out of space!");
+			}
+			
+			_offset = offset + size;
+			
+			return {_buffer.get(), offset, size, _data + offset};
+		}
+	}
+}
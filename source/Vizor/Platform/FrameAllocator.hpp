@@ -0,0 +1,86 @@
+//
+//  FrameAllocator.hpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include <Vizor/GraphicsContext.hpp>
+
+#include <cstring>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		// A persistently mapped buffer divided into one region per frame in flight, which is sub-allocated linearly for uniform and other per-frame data. A region is reused once its frame has completed, so allocation is just a pointer bump.
+		class FrameAllocator : public GraphicsContext
+		{
+		public:
+			FrameAllocator(const GraphicsContext & graphics_context, vk::DeviceSize capacity, std::size_t frames_in_flight, vk::BufferUsageFlags usage = vk::BufferUsageFlagBits::eUniformBuffer);
+			virtual ~FrameAllocator();
+			
+			FrameAllocator(const FrameAllocator &) = delete;
+			
+			struct Allocation
+			{
+				vk::Buffer buffer;
+				vk::DeviceSize offset;
+				vk::DeviceSize size;
+				
+				// Host visible and coherent, so writes don't need to be flushed.
+				void * data;
+				
+				// For binding with a dynamic descriptor, which refers to offset zero.
+				std::uint32_t dynamic_offset() const noexcept {return offset;}
+				
+				vk::DescriptorBufferInfo descriptor() const noexcept {return vk::DescriptorBufferInfo(buffer, offset, size);}
+			};
+			
+			vk::Buffer buffer() const noexcept {return _buffer.get();}
+			
+			// The number of bytes available to each frame.
+			vk::DeviceSize capacity() const noexcept {return _capacity;}
+			
+			// The alignment of every allocation, which satisfies the device's minimum offset alignment for the buffer usage.
+			vk::DeviceSize alignment() const noexcept {return _alignment;}
+			
+			// The number of bytes allocated in the current frame.
+			vk::DeviceSize used() const noexcept {return _offset - _region_offset;}
+			
+			// Start allocating from the region of the given frame in flight, discarding everything previously allocated from it. The frame must have completed, e.g. by FramePresenter::acquire().
+			void begin(std::size_t frame_index);
+			
+			// Allocate from the current frame. Throws if the frame's region is full.
+			Allocation allocate(vk::DeviceSize size);
+			
+			// Allocate and copy a value, which must be trivially copyable.
+			template <typename ValueT>
+			Allocation write(const ValueT & value)
+			{
+				auto allocation = allocate(sizeof(ValueT));
+				
+				std::memcpy(allocation.data, &value, sizeof(ValueT));
+				
+				return allocation;
+			}
+			
+		protected:
+			std::uint32_t find_memory_type(std::uint32_t memory_type_bits, vk::MemoryPropertyFlags properties) const;
+			
+			vk::DeviceSize _alignment = 1;
+			vk::DeviceSize _capacity = 0;
+			std::size_t _frames_in_flight = 0;
+			
+			vk::UniqueBuffer _buffer;
+			vk::UniqueDeviceMemory _memory;
+			std::uint8_t * _data = nullptr;
+			
+			vk::DeviceSize _region_offset = 0;
+			vk::DeviceSize _offset = 0;
+		};
+	}
+}
@@ -0,0 +1,69 @@
+//
+//  FrameCommandPools.cpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "FrameCommandPools.hpp"
+
+#include <stdexcept>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		FrameCommandPools::FrameCommandPools(const GraphicsContext & graphics_context, std::uint32_t queue_family_index, std::size_t thread_count) : GraphicsContext(graphics_context)
+		{
+			if (thread_count == 0) {
+				throw std::invalid_argument("Frame command pools require at least one thread!");
+			}
+			
+			// Command buffers are re-recorded every frame, so they are short lived and never reset individually:
+			auto command_pool_create_info = vk::CommandPoolCreateInfo()
+				.setQueueFamilyIndex(queue_family_index)
+				.setFlags(vk::CommandPoolCreateFlagBits::eTransient);
+			
+			_pools.resize(thread_count);
+			
+			for (auto & pool : _pools) {
+				pool.command_pool = _device.createCommandPoolUnique(command_pool_create_info, _allocation_callbacks);
+			}
+		}
+		
+		FrameCommandPools::~FrameCommandPools()
+		{
+		}
+		
+		vk::CommandBuffer FrameCommandPools::allocate(std::size_t thread_index, vk::CommandBufferLevel level)
+		{
+			auto & pool = _pools.at(thread_index);
+			
+			auto & command_buffers = level == vk::CommandBufferLevel::ePrimary ? pool.primary_command_buffers : pool.secondary_command_buffers;
+			auto & used = level == vk::CommandBufferLevel::ePrimary ? pool.primary_used : pool.secondary_used;
+			
+			if (used == command_buffers.size()) {
+				auto allocate_info = vk::CommandBufferAllocateInfo()
+					.setCommandPool(pool.command_pool.get())
+					.setLevel(level)
+					.setCommandBufferCount(1);
+				
+				auto allocated = _device.allocateCommandBuffersUnique(allocate_info);
+				command_buffers.push_back(std::move(allocated.front()));
+			}
+			
+			return command_buffers[used++].get();
+		}
+		
+		void FrameCommandPools::reset()
+		{
+			for (auto & pool : _pools) {
+				_device.resetCommandPool(pool.command_pool.get(), vk::CommandPoolResetFlags());
+				
+				pool.primary_used = 0;
+				pool.secondary_used = 0;
+			}
+		}
+	}
+}
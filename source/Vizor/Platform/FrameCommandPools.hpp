@@ -0,0 +1,49 @@
+//
+//  FrameCommandPools.hpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include <Vizor/GraphicsContext.hpp>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		// Transient command pools for a single frame in flight, one per recording thread. Every pool is reset at once when the frame is reused, rather than resetting command buffers individually.
+		class FrameCommandPools : public GraphicsContext
+		{
+		public:
+			FrameCommandPools(const GraphicsContext & graphics_context, std::uint32_t queue_family_index, std::size_t thread_count = 1);
+			virtual ~FrameCommandPools();
+			
+			FrameCommandPools(const FrameCommandPools &) = delete;
+			
+			std::size_t thread_count() const noexcept {return _pools.size();}
+			
+			// A command buffer from the given thread's pool, ready to record. Command buffers are recycled by reset(), so after the first few frames this doesn't allocate. Each pool must only be used by one thread at a time.
+			vk::CommandBuffer allocate(std::size_t thread_index = 0, vk::CommandBufferLevel level = vk::CommandBufferLevel::ePrimary);
+			
+			// Reset every pool, so that all command buffers can be allocated again. The frame which used them must have completed.
+			void reset();
+			
+		protected:
+			struct Pool
+			{
+				vk::UniqueCommandPool command_pool;
+				
+				std::vector<vk::UniqueCommandBuffer> primary_command_buffers;
+				std::size_t primary_used = 0;
+				
+				std::vector<vk::UniqueCommandBuffer> secondary_command_buffers;
+				std::size_t secondary_used = 0;
+			};
+			
+			std::vector<Pool> _pools;
+		};
+	}
+}
@@ -0,0 +1,174 @@
+//
+//  FrameCounters.cpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "FrameCounters.hpp"
+
+#include <stdexcept>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		// Results are written in the order of the flag bits:
+		static const vk::QueryPipelineStatisticFlags PIPELINE_STATISTICS =
+			vk::QueryPipelineStatisticFlagBits::eInputAssemblyPrimitives |
+			vk::QueryPipelineStatisticFlagBits::eVertexShaderInvocations |
+			vk::QueryPipelineStatisticFlagBits::eClippingInvocations |
+			vk::QueryPipelineStatisticFlagBits::eClippingPrimitives |
+			vk::QueryPipelineStatisticFlagBits::eFragmentShaderInvocations;
+		
+		static const std::size_t PIPELINE_STATISTICS_COUNT = 5;
+		
+		FrameCounters::FrameCounters(const GraphicsContext & graphics_context, const DeviceFeatures & enabled_features, std::size_t frames_in_flight, std::uint32_t maximum_passes) : GraphicsContext(graphics_context), _maximum_passes(maximum_passes), _slots(frames_in_flight)
+		{
+			auto query_count = frames_in_flight * _maximum_passes;
+			
+			_inherited_queries = enabled_features.core.inheritedQueries;
+			
+			if (enabled_features.core.occlusionQueryPrecise) {
+				_occlusion_query_flags = vk::QueryControlFlagBits::ePrecise;
+			}
+			
+			_occlusion_query_pool = _device.createQueryPoolUnique(
+				vk::QueryPoolCreateInfo()
+					.setQueryType(vk::QueryType::eOcclusion)
+					.setQueryCount(query_count),
+				_allocation_callbacks
+			);
+			
+			if (enabled_features.core.pipelineStatisticsQuery) {
+				_statistics_query_pool = _device.createQueryPoolUnique(
+					vk::QueryPoolCreateInfo()
+						.setQueryType(vk::QueryType::ePipelineStatistics)
+						.setQueryCount(query_count)
+						.setPipelineStatistics(PIPELINE_STATISTICS),
+					_allocation_callbacks
+				);
+			}
+		}
+		
+		FrameCounters::~FrameCounters()
+		{
+		}
+		
+		vk::CommandBufferInheritanceInfo FrameCounters::inheritance_info() const
+		{
+			if (!_inherited_queries) {
+				throw std::logic_error("Counting passes across secondary command buffers requires the inheritedQueries feature!");
+			}
+			
+			auto inheritance_info = vk::CommandBufferInheritanceInfo()
+				.setOcclusionQueryEnable(true)
+				.setQueryFlags(_occlusion_query_flags);
+			
+			if (_statistics_query_pool) {
+				inheritance_info.setPipelineStatistics(PIPELINE_STATISTICS);
+			}
+			
+			return inheritance_info;
+		}
+		
+		void FrameCounters::begin(FramePresenter::Frame & frame)
+		{
+			_current = frame.index;
+			
+			collect(_current);
+			
+			auto & slot = _slots[_current];
+			slot.frame = frame.serial;
+			slot.names.clear();
+			
+			auto first_query = _current * _maximum_passes;
+			
+			frame.command_buffer.resetQueryPool(_occlusion_query_pool.get(), first_query, _maximum_passes);
+			
+			if (_statistics_query_pool) {
+				frame.command_buffer.resetQueryPool(_statistics_query_pool.get(), first_query, _maximum_passes);
+			}
+		}
+		
+		std::uint32_t FrameCounters::begin_pass(vk::CommandBuffer command_buffer, const char * name)
+		{
+			auto & slot = _slots[_current];
+			
+			if (slot.names.size() == _maximum_passes) return NONE;
+			
+			std::uint32_t pass = slot.names.size();
+			slot.names.push_back(name);
+			
+			auto query = _current * _maximum_passes + pass;
+			
+			command_buffer.beginQuery(_occlusion_query_pool.get(), query, _occlusion_query_flags);
+			
+			if (_statistics_query_pool) {
+				command_buffer.beginQuery(_statistics_query_pool.get(), query, vk::QueryControlFlags());
+			}
+			
+			return pass;
+		}
+		
+		void FrameCounters::end_pass(vk::CommandBuffer command_buffer, std::uint32_t pass)
+		{
+			if (pass == NONE) return;
+			
+			auto query = _current * _maximum_passes + pass;
+			
+			if (_statistics_query_pool) {
+				command_buffer.endQuery(_statistics_query_pool.get(), query);
+			}
+			
+			command_buffer.endQuery(_occlusion_query_pool.get(), query);
+		}
+		
+		void FrameCounters::collect(std::size_t slot_index)
+		{
+			auto & slot = _slots[slot_index];
+			
+			if (slot.names.empty()) return;
+			
+			auto first_query = slot_index * _maximum_passes;
+			auto count = slot.names.size();
+			
+			// Never wait: if the results aren't available yet, the previous counters are kept:
+			std::vector<std::uint64_t> samples_passed(count);
+			
+			auto result = _device.getQueryPoolResults(_occlusion_query_pool.get(), first_query, count, samples_passed.size() * sizeof(std::uint64_t), samples_passed.data(), sizeof(std::uint64_t), vk::QueryResultFlagBits::e64);
+			
+			if (result != vk::Result::eSuccess) return;
+			
+			std::vector<std::uint64_t> statistics;
+			
+			if (_statistics_query_pool) {
+				statistics.resize(count * PIPELINE_STATISTICS_COUNT);
+				
+				result = _device.getQueryPoolResults(_statistics_query_pool.get(), first_query, count, statistics.size() * sizeof(std::uint64_t), statistics.data(), PIPELINE_STATISTICS_COUNT * sizeof(std::uint64_t), vk::QueryResultFlagBits::e64);
+				
+				if (result != vk::Result::eSuccess) statistics.clear();
+			}
+			
+			_counters.clear();
+			
+			for (std::size_t pass = 0; pass < count; pass += 1) {
+				Counters counters = {slot.names[pass], slot.frame, samples_passed[pass], false};
+				
+				if (!statistics.empty()) {
+					auto values = statistics.data() + pass * PIPELINE_STATISTICS_COUNT;
+					
+					counters.has_statistics = true;
+					counters.input_assembly_primitives = values[0];
+					counters.vertex_shader_invocations = values[1];
+					counters.clipping_invocations = values[2];
+					counters.clipping_primitives = values[3];
+					counters.fragment_shader_invocations = values[4];
+				}
+				
+				_counters.push_back(counters);
+			}
+		}
+	}
+}
@@ -0,0 +1,88 @@
+//
+//  FrameCounters.hpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "FramePresenter.hpp"
+#include "DeviceFeatures.hpp"
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		// Counts samples and pipeline work per pass using occlusion and pipeline statistics queries, with a set of queries per frame in flight. Results are read without waiting once the frame's slot is reused, so they are frames_in_flight frames late.
+		class FrameCounters : public GraphicsContext
+		{
+		public:
+			static constexpr std::uint32_t NONE = UINT32_MAX;
+			
+			struct Counters
+			{
+				const char * name;
+				std::uint64_t frame;
+				
+				// The number of samples which passed the depth and stencil tests. Only zero or non-zero unless occlusionQueryPrecise is enabled.
+				std::uint64_t samples_passed;
+				
+				// Only available if pipelineStatisticsQuery is enabled.
+				bool has_statistics;
+				std::uint64_t input_assembly_primitives;
+				std::uint64_t vertex_shader_invocations;
+				std::uint64_t clipping_invocations;
+				std::uint64_t clipping_primitives;
+				std::uint64_t fragment_shader_invocations;
+			};
+			
+			// Pipeline statistics and precise occlusion are used if they are in the given enabled features, e.g. SurfaceDevice::enabled_features().
+			FrameCounters(const GraphicsContext & graphics_context, const DeviceFeatures & enabled_features, std::size_t frames_in_flight, std::uint32_t maximum_passes = 16);
+			virtual ~FrameCounters();
+			
+			FrameCounters(const FrameCounters &) = delete;
+			
+			bool has_statistics() const noexcept {return bool(_statistics_query_pool);}
+			
+			// Whether passes may span secondary command buffers, which requires the inheritedQueries feature.
+			bool inherits_queries() const noexcept {return _inherited_queries;}
+			
+			// The query state for secondary command buffers which execute within a pass, e.g. for ParallelRecorder::record(). Throws if inheritedQueries is not enabled.
+			vk::CommandBufferInheritanceInfo inheritance_info() const;
+			
+			// Read the results from the last time this frame's slot was used, and reset its queries. Must be called after acquiring the frame, before anything else is recorded into its command buffer.
+			void begin(FramePresenter::Frame & frame);
+			
+			// Start counting a pass. Secondary command buffers executed within it must inherit the query state, see inheritance_info(). Returns NONE if the frame has no more queries available.
+			std::uint32_t begin_pass(vk::CommandBuffer command_buffer, const char * name);
+			void end_pass(vk::CommandBuffer command_buffer, std::uint32_t pass);
+			
+			// The counters for each pass of the most recent frame which has been read back.
+			const std::vector<Counters> & counters() const noexcept {return _counters;}
+			
+		protected:
+			void collect(std::size_t slot_index);
+			
+			std::uint32_t _maximum_passes;
+			
+			bool _inherited_queries = false;
+			
+			vk::QueryControlFlags _occlusion_query_flags;
+			vk::UniqueQueryPool _occlusion_query_pool;
+			vk::UniqueQueryPool _statistics_query_pool;
+			
+			struct Slot
+			{
+				std::uint64_t frame = 0;
+				std::vector<const char *> names;
+			};
+			
+			std::vector<Slot> _slots;
+			std::size_t _current = 0;
+			
+			std::vector<Counters> _counters;
+		};
+	}
+}
@@ -0,0 +1,322 @@
+//
+//  FramePresenter.cpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "FramePresenter.hpp"
+
+#include <Logger/Console.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		using namespace Logger;
+		
+		FramePresenter::FramePresenter(RenderTarget & render_target, std::size_t frames_in_flight, Synchronisation synchronisation, std::size_t thread_count) : SurfaceContext(render_target), _synchronisation(synchronisation), _render_target(render_target)
+		{
+			if (frames_in_flight == 0) {
+				throw std::invalid_argument("Frame presenter requires at least one frame in flight!");
+			}
+			
+			setup_timeline();
+			setup_frames(frames_in_flight, thread_count);
+		}
+		
+		// Validate before anything is created, as a timeline semaphore on a device without the feature is invalid usage rather than an error:
+		static FramePresenter::Synchronisation validate(FramePresenter::Synchronisation synchronisation, const DeviceFeatures & enabled_features)
+		{
+			if (!FramePresenter::supports(synchronisation, enabled_features)) {
+				throw std::runtime_error("Timeline synchronisation requires Vulkan 1.2 and the timelineSemaphore device feature!");
+			}
+			
+			return synchronisation;
+		}
+		
+		FramePresenter::FramePresenter(RenderTarget & render_target, const DeviceFeatures & enabled_features, std::size_t frames_in_flight, Synchronisation synchronisation, std::size_t thread_count) : FramePresenter(render_target, frames_in_flight, validate(synchronisation, enabled_features), thread_count)
+		{
+		}
+		
+		bool FramePresenter::supports(Synchronisation synchronisation, const DeviceFeatures & enabled_features) noexcept
+		{
+			if (synchronisation != Synchronisation::TIMELINE) return true;
+			
+#if defined(VK_VERSION_1_2)
+			return enabled_features.vulkan12.timelineSemaphore;
+#else
+			return false;
+#endif
+		}
+		
+		FramePresenter::~FramePresenter()
+		{
+		}
+		
+		FramePresenter::Frame * FramePresenter::acquire(std::uint64_t timeout)
+		{
+			auto begin = _trace ? _trace->now() : 0;
+			auto & frame = _frames[_current_frame];
+			
+			// Frame N waits for frame N - frames_in_flight, which last used this slot:
+			{
+				FrameTrace::Scope scope(_trace, "wait", _serial + 1);
+				
+				if (!wait_for(frame.serial, frame.fence, timeout)) {
+					_status = Status::TIMEOUT;
+					return nullptr;
+				}
+			}
+			
+			// Frames complete in submission order, so every frame up to and including this one has now completed:
+			auto & retirement_queue = _render_target.retirement_queue();
+			retirement_queue.collect(_synchronisation == Synchronisation::TIMELINE ? completed_serial() : frame.serial);
+			
+			{
+				FrameTrace::Scope scope(_trace, "acquire", _serial + 1);
+				
+				_status = _render_target.acquire(frame.image_available, nullptr, timeout, frame.image_index);
+			}
+			
+			// Rather than spinning while the window is minimised, block until the surface changes or the poll interval expires:
+			if (_status == Status::SUSPENDED) {
+				FrameTrace::Scope scope(_trace, "suspended", _serial + 1);
+				
+				_render_target.wait_for_surface(timeout);
+				
+				return nullptr;
+			}
+			
+			if (_status != Status::OK && _status != Status::SUBOPTIMAL) {
+				return nullptr;
+			}
+			
+			// Only consume a serial once the image was acquired, as the frame will now be submitted:
+			frame.serial = ++_serial;
+			retirement_queue.advance(frame.serial);
+			
+			// The time between successive frames, which includes everything the application does in between:
+			if (_trace && _frame_begin) {
+				_trace->record("frame", frame.serial - 1, _frame_begin, begin);
+			}
+			
+			_frame_begin = begin;
+			
+			// A recreated swapchain has new images, none of which are in use yet:
+			frame.swapchain = _render_target.swapchain();
+			
+			if (_render_target.generation() != _generation) {
+				_images_in_flight.assign(_render_target.buffers().size(), {0, nullptr});
+				_generation = _render_target.generation();
+			}
+			
+			// The image may still be in use by an earlier frame if the swapchain hands back images out of order. There is no need to wait if it was this slot, as we just did:
+			auto & image_in_flight = _images_in_flight[frame.image_index];
+			
+			if (image_in_flight.serial && !(image_in_flight.fence && image_in_flight.fence == frame.fence)) {
+				FrameTrace::Scope scope(_trace, "wait image", frame.serial);
+				
+				wait_for(image_in_flight.serial, image_in_flight.fence, UINT64_MAX);
+			}
+			
+			image_in_flight = {frame.serial, frame.fence};
+			
+			// Resetting the whole pool is much cheaper than resetting each command buffer:
+			frame.command_pools->reset();
+			frame.command_buffer = frame.command_pools->allocate();
+			
+			return &frame;
+		}
+		
+		void FramePresenter::submit(Frame & frame)
+		{
+			FrameTrace::Scope scope(_trace, "submit", frame.serial);
+			
+			submit_command_buffer(frame);
+			
+			// Advance before presenting so that a failed present doesn't reuse the same frame slot:
+			_current_frame = (_current_frame + 1) % _frames.size();
+		}
+		
+		FramePresenter::Status FramePresenter::present(Frame & frame)
+		{
+			submit(frame);
+			
+			FrameTrace::Scope scope(_trace, "present", frame.serial);
+			
+			return _status = _render_target.present(_present_queue, frame.swapchain, frame.render_finished, frame.image_index);
+		}
+		
+		void FramePresenter::submit_command_buffer(Frame & frame)
+		{
+			vk::PipelineStageFlags wait_stages[] = {vk::PipelineStageFlagBits::eColorAttachmentOutput};
+			
+			auto submit_info = vk::SubmitInfo()
+				.setWaitSemaphoreCount(1)
+				.setPWaitSemaphores(&frame.image_available)
+				.setPWaitDstStageMask(wait_stages)
+				.setCommandBufferCount(1)
+				.setPCommandBuffers(&frame.command_buffer)
+				.setSignalSemaphoreCount(1)
+				.setPSignalSemaphores(&frame.render_finished);
+			
+#if defined(VK_VERSION_1_2)
+			if (_timeline) {
+				// Presentation can only wait on binary semaphores, so render_finished is still signalled alongside the timeline. The values for binary semaphores are ignored:
+				std::uint64_t wait_values[] = {0};
+				vk::Semaphore signal_semaphores[] = {frame.render_finished, _timeline->semaphore()};
+				std::uint64_t signal_values[] = {0, frame.serial};
+				
+				auto timeline_semaphore_submit_info = vk::TimelineSemaphoreSubmitInfo()
+					.setWaitSemaphoreValueCount(1)
+					.setPWaitSemaphoreValues(wait_values)
+					.setSignalSemaphoreValueCount(2)
+					.setPSignalSemaphoreValues(signal_values);
+				
+				submit_info
+					.setPNext(&timeline_semaphore_submit_info)
+					.setSignalSemaphoreCount(2)
+					.setPSignalSemaphores(signal_semaphores);
+				
+				_graphics_queue.submit(submit_info, nullptr);
+				
+				return;
+			}
+#endif
+			
+			// These throw on failure (e.g. device lost), as otherwise the fence would never be signalled and the next wait on this slot would never return:
+			_device.resetFences(frame.fence);
+			
+			_graphics_queue.submit(submit_info, frame.fence);
+		}
+		
+		bool FramePresenter::wait_for(std::uint64_t serial, vk::Fence fence, std::uint64_t timeout)
+		{
+#if defined(VK_VERSION_1_2)
+			if (_timeline) {
+				return _timeline->wait(serial, timeout);
+			}
+#endif
+			
+			// As with the timeline, anything other than success or a timeout (e.g. device lost) throws:
+			return _device.waitForFences(fence, true, timeout) == vk::Result::eSuccess;
+		}
+		
+		std::uint64_t FramePresenter::completed_serial() const
+		{
+#if defined(VK_VERSION_1_2)
+			if (_timeline) {
+				return _timeline->value();
+			}
+#endif
+			
+			// Every frame before the oldest one in flight has completed, as its slot was waited on before being reused:
+			std::uint64_t oldest_serial = _serial, completed_serial = 0;
+			
+			for (auto & frame : _frames) {
+				oldest_serial = std::min(oldest_serial, frame.serial);
+				
+				if (_device.getFenceStatus(frame.fence) == vk::Result::eSuccess) {
+					completed_serial = std::max(completed_serial, frame.serial);
+				}
+			}
+			
+			if (oldest_serial > 0) {
+				completed_serial = std::max(completed_serial, oldest_serial - 1);
+			}
+			
+			return completed_serial;
+		}
+		
+		void FramePresenter::wait()
+		{
+#if defined(VK_VERSION_1_2)
+			if (_timeline) {
+				_timeline->wait(_serial);
+			}
+#endif
+			
+			if (_synchronisation == Synchronisation::FENCES) {
+				std::vector<vk::Fence> fences;
+				fences.reserve(_frames.size());
+				
+				for (auto & frame : _frames) {
+					fences.push_back(frame.fence);
+				}
+				
+				_device.waitForFences(fences.size(), fences.data(), true, UINT64_MAX);
+			}
+			
+			_render_target.retirement_queue().collect(_serial);
+		}
+		
+		void FramePresenter::reset()
+		{
+			_images_in_flight.clear();
+			_generation = 0;
+			_current_frame = 0;
+		}
+		
+		void FramePresenter::setup_timeline()
+		{
+			if (_synchronisation != Synchronisation::TIMELINE) return;
+			
+#if defined(VK_VERSION_1_2)
+			_timeline = std::make_unique<TimelineSemaphore>(*this, _serial);
+#else
+			throw std::runtime_error("Timeline synchronisation requires Vulkan 1.2!");
+#endif
+		}
+		
+		void FramePresenter::setup_frames(std::size_t frames_in_flight, std::size_t thread_count)
+		{
+			Console::info("Setting up frame presenter with", frames_in_flight, "frames in flight using", _synchronisation == Synchronisation::TIMELINE ? "timeline" : "fence", "synchronisation...");
+			
+			auto queue_family_index = _render_target.queue_family_indices().graphics_queue_family_index;
+			
+			auto semaphore_create_info = vk::SemaphoreCreateInfo();
+			
+			auto fence_create_info = vk::FenceCreateInfo()
+				.setFlags(vk::FenceCreateFlagBits::eSignaled);
+			
+			_slots.clear();
+			_slots.reserve(frames_in_flight);
+			
+			_frames.clear();
+			_frames.reserve(frames_in_flight);
+			
+			for (std::size_t index = 0; index < frames_in_flight; index += 1) {
+				Slot slot;
+				
+				slot.command_pools = std::make_unique<FrameCommandPools>(*this, queue_family_index, thread_count);
+				slot.image_available = _device.createSemaphoreUnique(semaphore_create_info, _allocation_callbacks);
+				slot.render_finished = _device.createSemaphoreUnique(semaphore_create_info, _allocation_callbacks);
+				
+				if (_synchronisation == Synchronisation::FENCES) {
+					slot.fence = _device.createFenceUnique(fence_create_info, _allocation_callbacks);
+				}
+				
+				_frames.push_back({
+					index,
+					0,
+					nullptr,
+					0,
+					nullptr,
+					slot.command_pools.get(),
+					slot.image_available.get(),
+					slot.render_finished.get(),
+					slot.fence.get()
+				});
+				
+				_slots.push_back(std::move(slot));
+			}
+			
+			reset();
+		}
+	}
+}
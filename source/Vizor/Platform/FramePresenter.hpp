@@ -0,0 +1,162 @@
+//
+//  FramePresenter.hpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "RenderTarget.hpp"
+#include "DeviceFeatures.hpp"
+#include "TimelineSemaphore.hpp"
+#include "FrameCommandPools.hpp"
+#include "FrameTrace.hpp"
+
+#include <memory>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		// Owns the acquire/submit/present loop for a render target (usually a swapchain), with a fixed number of frames in flight.
+		class FramePresenter : public SurfaceContext
+		{
+		public:
+			// The resources which belong to a single frame in flight. Only valid between acquire() and present().
+			struct Frame
+			{
+				// The frame in flight slot, in the range [0, frames_in_flight).
+				std::size_t index;
+				
+				// A monotonically increasing frame number, used to retire resources once the frame has completed.
+				std::uint64_t serial;
+				
+				// The image which was acquired for this frame. The swapchain is null when rendering to an offscreen target.
+				vk::SwapchainKHR swapchain;
+				std::uint32_t image_index;
+				
+				// A primary command buffer from the frame's command pools.
+				vk::CommandBuffer command_buffer;
+				
+				// Transient command pools which are reset when the frame is acquired, with one pool per recording thread.
+				FrameCommandPools * command_pools;
+				
+				vk::Semaphore image_available;
+				vk::Semaphore render_finished;
+				
+				// Signalled when the frame completes. Null when using timeline synchronisation, where the timeline reaches the frame's serial instead.
+				vk::Fence fence;
+			};
+			
+			enum class Synchronisation {
+				// A fence per frame in flight, which is waited on and reset every frame.
+				FENCES,
+				
+				// A single timeline semaphore which is signalled with each frame's serial. Requires Vulkan 1.2 and the timelineSemaphore device feature.
+				TIMELINE
+			};
+			
+			FramePresenter(RenderTarget & render_target, std::size_t frames_in_flight = 2, Synchronisation synchronisation = Synchronisation::FENCES, std::size_t thread_count = 1);
+			
+			// As above, but first check that the synchronisation is supported by the features the device was created with (e.g. SurfaceDevice::enabled_features()), and throw if not.
+			FramePresenter(RenderTarget & render_target, const DeviceFeatures & enabled_features, std::size_t frames_in_flight = 2, Synchronisation synchronisation = Synchronisation::FENCES, std::size_t thread_count = 1);
+			
+			// Whether the given synchronisation can be used with a device which has the given features enabled.
+			static bool supports(Synchronisation synchronisation, const DeviceFeatures & enabled_features) noexcept;
+			virtual ~FramePresenter();
+			
+			FramePresenter(const FramePresenter &) = delete;
+			
+			RenderTarget & render_target() noexcept {return _render_target;}
+			std::size_t frames_in_flight() const noexcept {return _frames.size();}
+			Synchronisation synchronisation() const noexcept {return _synchronisation;}
+			
+			typedef RenderTarget::Status Status;
+			
+			// Wait until the next frame slot is free and acquire a swapchain image for it. The frame's command pools are reset, and the returned command buffer is ready to record. Returns nullptr if no image could be acquired, in which case status() explains why. The swapchain is recreated as required, so the caller can simply try again, except after SURFACE_LOST, which is terminal: the surface (and everything presenting to it) must be recreated. While the surface is suspended, this blocks until it changes (or the poll interval expires), so the render loop doesn't spin.
+			Frame * acquire(std::uint64_t timeout = UINT64_MAX);
+			
+			// Submit the frame's command buffer to the graphics queue and present the acquired image.
+			Status present(Frame & frame);
+			
+			// Submit the frame's command buffer without presenting it, so that it can be presented along with other swapchains by a PresentBatch.
+			void submit(Frame & frame);
+			
+			// The status of the most recent acquire or present.
+			Status status() const noexcept {return _status;}
+			
+			// The serial of the most recently acquired frame.
+			std::uint64_t serial() const noexcept {return _serial;}
+			
+			// The serial of the most recent frame known to have completed on the GPU.
+			std::uint64_t completed_serial() const;
+			
+#if defined(VK_VERSION_1_2)
+			// The timeline which reaches each frame's serial as it completes, or nullptr when using fences. Other work on the graphics queue may wait on it, but must not signal it.
+			const TimelineSemaphore * timeline() const noexcept {return _timeline.get();}
+#endif
+			
+			// Record CPU spans for each stage of the frame (wait, acquire, submit and present) and the time between frames, or stop recording if null. The trace must outlive the presenter.
+			void set_trace(FrameTrace * trace) noexcept {_trace = trace;}
+			FrameTrace * trace() const noexcept {return _trace;}
+			
+			// Wait for every frame in flight to complete, and release everything which was retired. Must not be called between acquire() and present().
+			void wait();
+			
+			// Discard per-image tracking. This happens automatically when the swapchain is recreated.
+			void reset();
+		
+		protected:
+			virtual void setup_timeline();
+			virtual void setup_frames(std::size_t frames_in_flight, std::size_t thread_count);
+			
+			// Wait until the frame with the given serial has completed, using the given fence if not using a timeline.
+			bool wait_for(std::uint64_t serial, vk::Fence fence, std::uint64_t timeout);
+			
+			void submit_command_buffer(Frame & frame);
+			
+			Synchronisation _synchronisation;
+			
+			RenderTarget & _render_target;
+		
+		private:
+			struct Slot
+			{
+				std::unique_ptr<FrameCommandPools> command_pools;
+				
+				vk::UniqueSemaphore image_available;
+				vk::UniqueSemaphore render_finished;
+				vk::UniqueFence fence;
+			};
+			
+#if defined(VK_VERSION_1_2)
+			std::unique_ptr<TimelineSemaphore> _timeline;
+#endif
+			
+			std::vector<Slot> _slots;
+			std::vector<Frame> _frames;
+			
+			// The frame which last rendered into each swapchain image, so that we never render into an image which is still in use.
+			struct ImageInFlight
+			{
+				std::uint64_t serial;
+				vk::Fence fence;
+			};
+			
+			std::uint64_t _generation = 0;
+			std::vector<ImageInFlight> _images_in_flight;
+			
+			std::size_t _current_frame = 0;
+			std::uint64_t _serial = 0;
+			
+			Status _status = Status::OK;
+			
+			FrameTrace * _trace = nullptr;
+			std::uint64_t _frame_begin = 0;
+			
+			friend class PresentBatch;
+		};
+	}
+}
@@ -0,0 +1,129 @@
+//
+//  FrameProfiler.cpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "FrameProfiler.hpp"
+
+#include <Logger/Console.hpp>
+
+#include <algorithm>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		using namespace Logger;
+		
+		FrameProfiler::FrameProfiler(const GraphicsContext & graphics_context, std::uint32_t queue_family_index, FrameTrace & trace, std::size_t frames_in_flight, std::uint32_t maximum_spans) : GraphicsContext(graphics_context), _trace(trace), _maximum_spans(maximum_spans), _slots(frames_in_flight)
+		{
+			// timestampComputeAndGraphics only covers every graphics and compute family, whereas the family itself is authoritative:
+			auto valid_bits = _physical_device.getQueueFamilyProperties().at(queue_family_index).timestampValidBits;
+			
+			_enabled = valid_bits > 0;
+			_timestamp_period = _physical_device.getProperties().limits.timestampPeriod;
+			
+			if (!_enabled) {
+				Console::warn("Queue family does not support timestamps, GPU spans will not be recorded.");
+				return;
+			}
+			
+			if (valid_bits < 64) {
+				_timestamp_mask = (std::uint64_t(1) << valid_bits) - 1;
+			}
+			
+			auto query_pool_create_info = vk::QueryPoolCreateInfo()
+				.setQueryType(vk::QueryType::eTimestamp)
+				.setQueryCount(frames_in_flight * _maximum_spans * 2);
+			
+			_query_pool = _device.createQueryPoolUnique(query_pool_create_info, _allocation_callbacks);
+			
+			_results.resize(_maximum_spans * 2);
+		}
+		
+		FrameProfiler::~FrameProfiler()
+		{
+		}
+		
+		void FrameProfiler::begin(FramePresenter::Frame & frame)
+		{
+			if (!_enabled) return;
+			
+			_current = frame.index;
+			
+			collect(_current);
+			
+			auto & slot = _slots[_current];
+			slot.frame = frame.serial;
+			slot.names.clear();
+			
+			frame.command_buffer.resetQueryPool(_query_pool.get(), _current * _maximum_spans * 2, _maximum_spans * 2);
+		}
+		
+		std::uint32_t FrameProfiler::begin_span(vk::CommandBuffer command_buffer, const char * name, vk::PipelineStageFlagBits stage)
+		{
+			if (!_enabled) return NONE;
+			
+			auto & slot = _slots[_current];
+			
+			if (slot.names.size() == _maximum_spans) return NONE;
+			
+			std::uint32_t span = slot.names.size();
+			slot.names.push_back(name);
+			
+			command_buffer.writeTimestamp(stage, _query_pool.get(), (_current * _maximum_spans + span) * 2);
+			
+			return span;
+		}
+		
+		void FrameProfiler::end_span(vk::CommandBuffer command_buffer, std::uint32_t span, vk::PipelineStageFlagBits stage)
+		{
+			if (span == NONE) return;
+			
+			command_buffer.writeTimestamp(stage, _query_pool.get(), (_current * _maximum_spans + span) * 2 + 1);
+		}
+		
+		void FrameProfiler::end(FramePresenter::Frame & frame)
+		{
+			if (!_enabled) return;
+			
+			_slots[frame.index].submitted = _trace.now();
+		}
+		
+		void FrameProfiler::collect(std::size_t slot_index)
+		{
+			auto & slot = _slots[slot_index];
+			
+			if (slot.names.empty()) return;
+			
+			auto count = slot.names.size() * 2;
+			
+			// The frame has completed, so unless a span was never ended, the results are available without waiting:
+			auto result = _device.getQueryPoolResults(_query_pool.get(), slot_index * _maximum_spans * 2, count, count * sizeof(std::uint64_t), _results.data(), sizeof(std::uint64_t), vk::QueryResultFlagBits::e64);
+			
+			if (result != vk::Result::eSuccess) return;
+			
+			// The bits above timestampValidBits are undefined, and the counter may wrap, so ticks are measured modulo the mask from the first timestamp:
+			auto origin = _results[0] & _timestamp_mask;
+			std::uint64_t last = 0;
+			
+			auto ticks = [&](std::uint64_t timestamp){
+				return ((timestamp & _timestamp_mask) - origin) & _timestamp_mask;
+			};
+			
+			for (std::size_t span = 0; span < slot.names.size(); span += 1) {
+				auto begin = slot.submitted + static_cast<std::uint64_t>(ticks(_results[span * 2]) * _timestamp_period);
+				auto end = slot.submitted + static_cast<std::uint64_t>(ticks(_results[span * 2 + 1]) * _timestamp_period);
+				
+				_trace.record({slot.names[span], slot.frame, begin, end, FrameTrace::GPU_TRACK});
+				
+				last = std::max(last, ticks(_results[span * 2 + 1]));
+			}
+			
+			_frame_time = {slot.frame, static_cast<std::uint64_t>(last * _timestamp_period)};
+		}
+	}
+}
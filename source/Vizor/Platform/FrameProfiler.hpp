@@ -0,0 +1,84 @@
+//
+//  FrameProfiler.hpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "FramePresenter.hpp"
+#include "FrameTrace.hpp"
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		// Measures GPU spans with timestamp queries, with a set of queries per frame in flight. The results are read once the frame has completed and recorded into a trace on the GPU track.
+		class FrameProfiler : public GraphicsContext
+		{
+		public:
+			static constexpr std::uint32_t NONE = UINT32_MAX;
+			
+			// The queue family is the one the frames are submitted to, which determines whether (and how many bits of) timestamps are supported.
+			FrameProfiler(const GraphicsContext & graphics_context, std::uint32_t queue_family_index, FrameTrace & trace, std::size_t frames_in_flight, std::uint32_t maximum_spans = 32);
+			virtual ~FrameProfiler();
+			
+			FrameProfiler(const FrameProfiler &) = delete;
+			
+			// Whether the queue family supports timestamps. If not, nothing is recorded.
+			bool enabled() const noexcept {return _enabled;}
+			
+			// Record the results from the last time this frame's slot was used, and reset its queries. Must be called after acquiring the frame, before anything else is recorded into its command buffer.
+			void begin(FramePresenter::Frame & frame);
+			
+			// Write a timestamp at the start of a span. Returns NONE if the frame has no more queries available. Must be recorded from the thread which called begin().
+			std::uint32_t begin_span(vk::CommandBuffer command_buffer, const char * name, vk::PipelineStageFlagBits stage = vk::PipelineStageFlagBits::eTopOfPipe);
+			void end_span(vk::CommandBuffer command_buffer, std::uint32_t span, vk::PipelineStageFlagBits stage = vk::PipelineStageFlagBits::eBottomOfPipe);
+			
+			struct FrameTime
+			{
+				// The frame which was measured, which is frames_in_flight behind the current one.
+				std::uint64_t serial = 0;
+				
+				// From the start of its first span to the end of its last, in nanoseconds.
+				std::uint64_t time = 0;
+			};
+			
+			// The GPU time of the most recently collected frame. Zero until a frame has completed. The serial only changes when a new frame is collected, so consumers can ignore results they have already seen.
+			const FrameTime & frame_time() const noexcept {return _frame_time;}
+			
+			// Mark the time at which the frame is submitted. Without calibrated timestamps, the GPU spans are placed relative to this.
+			void end(FramePresenter::Frame & frame);
+			
+		protected:
+			void collect(std::size_t slot_index);
+			
+			FrameTrace & _trace;
+			
+			bool _enabled = false;
+			double _timestamp_period = 1.0;
+			
+			// The valid bits of a timestamp, which may wrap around within a frame.
+			std::uint64_t _timestamp_mask = ~std::uint64_t(0);
+			
+			std::uint32_t _maximum_spans;
+			vk::UniqueQueryPool _query_pool;
+			
+			struct Slot
+			{
+				std::uint64_t frame = 0;
+				std::uint64_t submitted = 0;
+				
+				std::vector<const char *> names;
+			};
+			
+			std::vector<Slot> _slots;
+			std::size_t _current = 0;
+			
+			std::vector<std::uint64_t> _results;
+			FrameTime _frame_time;
+		};
+	}
+}
@@ -0,0 +1,202 @@
+//
+//  FrameReadback.cpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "FrameReadback.hpp"
+
+#include <Logger/Console.hpp>
+
+#include <stdexcept>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		using namespace Logger;
+		
+		FrameReadback::FrameReadback(const GraphicsContext & graphics_context, Callback callback, std::size_t depth) : GraphicsContext(graphics_context), _callback(callback), _slots(depth), _ring(depth)
+		{
+		}
+		
+		FrameReadback::~FrameReadback()
+		{
+		}
+		
+		vk::DeviceSize FrameReadback::bytes_per_pixel(vk::Format format)
+		{
+			switch (format) {
+				case vk::Format::eR8G8B8A8Unorm:
+				case vk::Format::eR8G8B8A8Srgb:
+				case vk::Format::eB8G8R8A8Unorm:
+				case vk::Format::eB8G8R8A8Srgb:
+				case vk::Format::eA2B10G10R10UnormPack32:
+				case vk::Format::eA2R10G10B10UnormPack32:
+					return 4;
+				case vk::Format::eR16G16B16A16Sfloat:
+					return 8;
+				case vk::Format::eR32G32B32A32Sfloat:
+					return 16;
+				default:
+					throw std::runtime_error("Unsupported readback format " + vk::to_string(format) + "!");
+			}
+		}
+		
+		bool FrameReadback::record(FramePresenter & frame_presenter, FramePresenter::Frame & frame, vk::ImageLayout layout, vk::PipelineStageFlags source_stage, vk::AccessFlags source_access)
+		{
+			auto & render_target = frame_presenter.render_target();
+			
+			// Free up as many buffers as possible before deciding whether to drop this frame:
+			collect(frame_presenter.completed_serial());
+			
+			return record(frame.command_buffer, frame.serial, render_target.buffers()[frame.image_index].image, render_target.extent(), render_target.surface_format().format, layout, source_stage, source_access);
+		}
+		
+		bool FrameReadback::record(vk::CommandBuffer command_buffer, std::uint64_t serial, vk::Image image, vk::Extent2D extent, vk::Format format, vk::ImageLayout layout, vk::PipelineStageFlags source_stage, vk::AccessFlags source_access)
+		{
+			auto index = _ring.reserve();
+			
+			if (index == ReadbackRing::NONE) return false;
+			
+			auto & slot = _slots[index];
+			
+			auto row_pitch = extent.width * bytes_per_pixel(format);
+			auto size = row_pitch * extent.height;
+			
+			// The slot isn't in use, so it is safe to replace its buffer:
+			if (size > slot.capacity) {
+				setup_slot(slot, size);
+			}
+			
+			auto subresource_range = vk::ImageSubresourceRange(vk::ImageAspectFlagBits::eColor, 0, 1, 0, 1);
+			
+			// Wait for whatever wrote the image to finish before copying:
+			auto acquire_barrier = vk::ImageMemoryBarrier()
+				.setSrcAccessMask(source_access)
+				.setDstAccessMask(vk::AccessFlagBits::eTransferRead)
+				.setOldLayout(layout)
+				.setNewLayout(vk::ImageLayout::eTransferSrcOptimal)
+				.setSrcQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
+				.setDstQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
+				.setImage(image)
+				.setSubresourceRange(subresource_range);
+			
+			command_buffer.pipelineBarrier(source_stage, vk::PipelineStageFlagBits::eTransfer, vk::DependencyFlags(), nullptr, nullptr, {acquire_barrier});
+			
+			auto buffer_image_copy = vk::BufferImageCopy()
+				.setBufferOffset(0)
+				.setBufferRowLength(0)
+				.setBufferImageHeight(0)
+				.setImageSubresource(vk::ImageSubresourceLayers(vk::ImageAspectFlagBits::eColor, 0, 0, 1))
+				.setImageOffset({0, 0, 0})
+				.setImageExtent({extent.width, extent.height, 1});
+			
+			command_buffer.copyImageToBuffer(image, vk::ImageLayout::eTransferSrcOptimal, slot.buffer.get(), {buffer_image_copy});
+			
+			// Return the image to its layout for presentation, and make the copy visible to the host:
+			auto release_barrier = vk::ImageMemoryBarrier()
+				.setSrcAccessMask(vk::AccessFlagBits::eTransferRead)
+				.setDstAccessMask(vk::AccessFlags())
+				.setOldLayout(vk::ImageLayout::eTransferSrcOptimal)
+				.setNewLayout(layout)
+				.setSrcQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
+				.setDstQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
+				.setImage(image)
+				.setSubresourceRange(subresource_range);
+			
+			auto buffer_barrier = vk::BufferMemoryBarrier()
+				.setSrcAccessMask(vk::AccessFlagBits::eTransferWrite)
+				.setDstAccessMask(vk::AccessFlagBits::eHostRead)
+				.setSrcQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
+				.setDstQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
+				.setBuffer(slot.buffer.get())
+				.setOffset(0)
+				.setSize(size);
+			
+			command_buffer.pipelineBarrier(vk::PipelineStageFlagBits::eTransfer, vk::PipelineStageFlagBits::eBottomOfPipe | vk::PipelineStageFlagBits::eHost, vk::DependencyFlags(), nullptr, {buffer_barrier}, {release_barrier});
+			
+			slot.capture = {serial, extent, format, slot.data, row_pitch, size};
+			
+			_ring.commit(index, serial);
+			
+			return true;
+		}
+		
+		std::size_t FrameReadback::collect(std::uint64_t completed_serial)
+		{
+			return _ring.collect(completed_serial, [&](std::size_t index){
+				auto & slot = _slots[index];
+				
+				if (!slot.coherent) {
+					auto mapped_memory_range = vk::MappedMemoryRange()
+						.setMemory(slot.memory.get())
+						.setOffset(0)
+						.setSize(VK_WHOLE_SIZE);
+					
+					_device.invalidateMappedMemoryRanges(1, &mapped_memory_range);
+				}
+				
+				if (_callback) {
+					_callback(slot.capture);
+				}
+			});
+		}
+		
+		std::uint32_t FrameReadback::find_memory_type(std::uint32_t memory_type_bits) const
+		{
+			auto memory_properties = _physical_device.getMemoryProperties();
+			
+			// Cached memory is much faster for the host to read, but may not be coherent, so prefer it but fall back to any host visible memory:
+			vk::MemoryPropertyFlags preferences[] = {
+				vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCached,
+				vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent,
+			};
+			
+			for (auto properties : preferences) {
+				for (std::uint32_t index = 0; index < memory_properties.memoryTypeCount; index += 1) {
+					if ((memory_type_bits & (1 << index)) && (memory_properties.memoryTypes[index].propertyFlags & properties) == properties) {
+						return index;
+					}
+				}
+			}
+			
+			throw std::runtime_error("Could not find host visible memory!");
+		}
+		
+		void FrameReadback::setup_slot(Slot & slot, vk::DeviceSize size)
+		{
+			Console::info("Allocating readback buffer of", size, "bytes");
+			
+			slot.data = nullptr;
+			slot.memory.reset();
+			slot.buffer.reset();
+			
+			auto buffer_create_info = vk::BufferCreateInfo()
+				.setSize(size)
+				.setUsage(vk::BufferUsageFlagBits::eTransferDst)
+				.setSharingMode(vk::SharingMode::eExclusive);
+			
+			slot.buffer = _device.createBufferUnique(buffer_create_info, _allocation_callbacks);
+			
+			auto memory_requirements = _device.getBufferMemoryRequirements(slot.buffer.get());
+			auto memory_type_index = find_memory_type(memory_requirements.memoryTypeBits);
+			
+			auto memory_allocate_info = vk::MemoryAllocateInfo()
+				.setAllocationSize(memory_requirements.size)
+				.setMemoryTypeIndex(memory_type_index);
+			
+			slot.memory = _device.allocateMemoryUnique(memory_allocate_info, _allocation_callbacks);
+			_device.bindBufferMemory(slot.buffer.get(), slot.memory.get(), 0);
+			
+			auto memory_properties = _physical_device.getMemoryProperties();
+			slot.coherent = bool(memory_properties.memoryTypes[memory_type_index].propertyFlags & vk::MemoryPropertyFlagBits::eHostCoherent);
+			
+			// The memory stays mapped until it is freed:
+			slot.data = _device.mapMemory(slot.memory.get(), 0, VK_WHOLE_SIZE);
+			slot.capacity = size;
+		}
+	}
+}
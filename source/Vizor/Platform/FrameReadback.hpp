@@ -0,0 +1,88 @@
+//
+//  FrameReadback.hpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "FramePresenter.hpp"
+#include "ReadbackRing.hpp"
+
+#include <functional>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		// Copies finished frames into a ring of persistently mapped host buffers, and hands each one to a callback once its frame has completed, without ever waiting on the device. If every buffer is still in flight, the frame is dropped rather than stalling the render thread.
+		class FrameReadback : public GraphicsContext
+		{
+		public:
+			// A tightly packed copy of a frame. The data is only valid for the duration of the callback.
+			struct Capture
+			{
+				std::uint64_t serial;
+				
+				vk::Extent2D extent;
+				vk::Format format;
+				
+				const void * data;
+				vk::DeviceSize row_pitch;
+				vk::DeviceSize size;
+			};
+			
+			typedef std::function<void(const Capture & capture)> Callback;
+			
+			// The depth is the number of buffers in the ring, which should be at least the number of frames in flight plus one.
+			FrameReadback(const GraphicsContext & graphics_context, Callback callback, std::size_t depth = 3);
+			virtual ~FrameReadback();
+			
+			FrameReadback(const FrameReadback &) = delete;
+			
+			std::size_t depth() const noexcept {return _ring.size();}
+			
+			// The number of frames which were recorded, delivered, and dropped because no buffer was free.
+			std::size_t recorded() const noexcept {return _ring.recorded();}
+			std::size_t delivered() const noexcept {return _ring.delivered();}
+			std::size_t dropped() const noexcept {return _ring.dropped();}
+			
+			// Record a copy of the frame's image at the end of its command buffer, before it is ended. The image is expected in the given layout and is returned to it afterwards. The copy waits for the given source stage and access, i.e. the last writes to the image, which by default are from rendering into it. Images written by a compute shader or a blit need the matching source. Swapchain images need the eTransferSrc image usage. Returns false if the frame was dropped.
+			bool record(FramePresenter & frame_presenter, FramePresenter::Frame & frame, vk::ImageLayout layout = vk::ImageLayout::ePresentSrcKHR, vk::PipelineStageFlags source_stage = vk::PipelineStageFlagBits::eColorAttachmentOutput, vk::AccessFlags source_access = vk::AccessFlagBits::eColorAttachmentWrite);
+			
+			// Record a copy of an arbitrary color image, which will be delivered once the given serial has completed.
+			bool record(vk::CommandBuffer command_buffer, std::uint64_t serial, vk::Image image, vk::Extent2D extent, vk::Format format, vk::ImageLayout layout, vk::PipelineStageFlags source_stage = vk::PipelineStageFlagBits::eColorAttachmentOutput, vk::AccessFlags source_access = vk::AccessFlagBits::eColorAttachmentWrite);
+			
+			// Deliver every capture whose frame has completed, in order. Returns the number delivered.
+			std::size_t collect(std::uint64_t completed_serial);
+			
+			// The size of each pixel, for the formats which can be read back.
+			static vk::DeviceSize bytes_per_pixel(vk::Format format);
+			
+		protected:
+			std::uint32_t find_memory_type(std::uint32_t memory_type_bits) const;
+			
+			struct Slot
+			{
+				vk::UniqueBuffer buffer;
+				vk::UniqueDeviceMemory memory;
+				vk::DeviceSize capacity = 0;
+				bool coherent = true;
+				void * data = nullptr;
+				
+				// The most recent copy recorded into this buffer.
+				Capture capture;
+			};
+			
+			virtual void setup_slot(Slot & slot, vk::DeviceSize size);
+			
+		private:
+			Callback _callback;
+			
+			std::vector<Slot> _slots;
+			ReadbackRing _ring;
+		};
+	}
+}
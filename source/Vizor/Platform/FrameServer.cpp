@@ -0,0 +1,301 @@
+//
+//  FrameServer.cpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "FrameServer.hpp"
+
+#if defined(__linux__)
+
+#include <Logger/Console.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		using namespace Logger;
+		
+		static std::system_error system_error(const char * what)
+		{
+			return std::system_error(errno, std::generic_category(), what);
+		}
+		
+		// Remove a stale socket, but never a regular file which happens to be at the same path:
+		static void unlink_socket(const std::string & path)
+		{
+			struct stat status;
+			
+			if (::lstat(path.c_str(), &status) == 0 && S_ISSOCK(status.st_mode)) {
+				::unlink(path.c_str());
+			}
+		}
+		
+		FrameServer::FrameServer(const std::string & path, std::uint64_t slot_size, std::size_t slot_count) : _path(path), _slot_size(slot_size), _slot_count(slot_count), _holders(slot_count, 0)
+		{
+			if (slot_count == 0) {
+				throw std::invalid_argument("Frame server requires at least one slot!");
+			}
+			
+			sockaddr_un address = {};
+			address.sun_family = AF_UNIX;
+			
+			if (path.size() >= sizeof(address.sun_path)) {
+				throw std::invalid_argument("Frame server path is too long!");
+			}
+			
+			std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+			
+			Console::info("Setting up frame server at", path, "with", slot_count, "slots of", slot_size, "bytes");
+			
+			try {
+				_memory = ::memfd_create("vizor-frame-server", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+				if (_memory == -1) throw system_error("memfd_create");
+				
+				if (::ftruncate(_memory, slot_size * slot_count) == -1) throw system_error("ftruncate");
+				
+				// Clients can rely on the size never changing underneath them:
+				if (::fcntl(_memory, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL) == -1) throw system_error("fcntl");
+				
+				auto data = ::mmap(nullptr, slot_size * slot_count, PROT_READ | PROT_WRITE, MAP_SHARED, _memory, 0);
+				if (data == MAP_FAILED) throw system_error("mmap");
+				
+				_data = static_cast<std::uint8_t *>(data);
+				
+				_socket = ::socket(AF_UNIX, SOCK_SEQPACKET | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+				if (_socket == -1) throw system_error("socket");
+				
+				unlink_socket(path);
+				
+				if (::bind(_socket, reinterpret_cast<sockaddr *>(&address), sizeof(address)) == -1) throw system_error("bind");
+				if (::listen(_socket, 8) == -1) throw system_error("listen");
+			} catch (...) {
+				close();
+				throw;
+			}
+		}
+		
+		FrameServer::~FrameServer()
+		{
+			close();
+		}
+		
+		void FrameServer::close()
+		{
+			for (auto & client : _clients) {
+				::close(client.socket);
+			}
+			
+			_clients.clear();
+			
+			if (_socket != -1) {
+				::close(_socket);
+				unlink_socket(_path);
+				_socket = -1;
+			}
+			
+			if (_data) {
+				::munmap(_data, _slot_size * _slot_count);
+				_data = nullptr;
+			}
+			
+			if (_memory != -1) {
+				::close(_memory);
+				_memory = -1;
+			}
+		}
+		
+		void FrameServer::update()
+		{
+			accept_clients();
+			
+			for (auto & client : _clients) {
+				while (receive(client));
+			}
+			
+			_clients.erase(std::remove_if(_clients.begin(), _clients.end(), [](const Client & client){return client.socket == -1;}), _clients.end());
+		}
+		
+		bool FrameServer::publish(const Frame & frame)
+		{
+			if (frame.size > _slot_size) {
+				throw std::invalid_argument("Frame is larger than the frame server slot size!");
+			}
+			
+			update();
+			
+			if (_clients.empty()) return false;
+			
+			// Use the next slot which no client is holding, so that slow clients don't hold up fast ones:
+			std::size_t slot = _slot_count;
+			
+			for (std::size_t index = 0; index < _slot_count; index += 1) {
+				auto candidate = (_next + index) % _slot_count;
+				
+				if (_holders[candidate] == 0) {
+					slot = candidate;
+					break;
+				}
+			}
+			
+			if (slot == _slot_count) {
+				_dropped += 1;
+				return false;
+			}
+			
+			_next = (slot + 1) % _slot_count;
+			
+			auto offset = slot * _slot_size;
+			std::memcpy(_data + offset, frame.data, frame.size);
+			
+			Message message = {};
+			message.type = MessageType::FRAME;
+			message.slot = slot;
+			message.serial = frame.serial;
+			message.width = frame.width;
+			message.height = frame.height;
+			message.format = frame.format;
+			message.slot_count = _slot_count;
+			message.slot_size = _slot_size;
+			message.offset = offset;
+			message.row_pitch = frame.row_pitch;
+			message.size = frame.size;
+			
+			for (auto & client : _clients) {
+				// A client whose socket buffer is full is behind, so it misses this frame rather than blocking the server:
+				if (send(client, message)) {
+					client.holding[slot] = true;
+					_holders[slot] += 1;
+				}
+			}
+			
+			_published += 1;
+			
+			return true;
+		}
+		
+		void FrameServer::accept_clients()
+		{
+			while (true) {
+				int socket = ::accept4(_socket, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+				
+				if (socket == -1) {
+					if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) break;
+					
+					throw system_error("accept4");
+				}
+				
+				_clients.push_back({socket, std::vector<bool>(_slot_count, false)});
+				auto & client = _clients.back();
+				
+				Message message = {};
+				message.type = MessageType::LAYOUT;
+				message.slot_count = _slot_count;
+				message.slot_size = _slot_size;
+				message.size = _slot_size * _slot_count;
+				
+				if (send(client, message, _memory)) {
+					Console::info("Frame server accepted client", socket);
+				} else {
+					disconnect(client);
+				}
+			}
+		}
+		
+		bool FrameServer::receive(Client & client)
+		{
+			if (client.socket == -1) return false;
+			
+			Message message;
+			auto result = ::recv(client.socket, &message, sizeof(message), MSG_DONTWAIT);
+			
+			if (result == -1 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
+				return false;
+			}
+			
+			// Zero means the client closed the connection:
+			if (result <= 0) {
+				disconnect(client);
+				return false;
+			}
+			
+			if (result == sizeof(message) && message.type == MessageType::RELEASE && message.slot < _slot_count && client.holding[message.slot]) {
+				client.holding[message.slot] = false;
+				_holders[message.slot] -= 1;
+			}
+			
+			return true;
+		}
+		
+		bool FrameServer::send(Client & client, const Message & message, int descriptor)
+		{
+			iovec iov = {const_cast<Message *>(&message), sizeof(message)};
+			
+			msghdr header = {};
+			header.msg_iov = &iov;
+			header.msg_iovlen = 1;
+			
+			// Space for passing a single file descriptor:
+			union {
+				cmsghdr align;
+				char buffer[CMSG_SPACE(sizeof(int))];
+			} control = {};
+			
+			if (descriptor != -1) {
+				header.msg_control = control.buffer;
+				header.msg_controllen = sizeof(control.buffer);
+				
+				auto cmsg = CMSG_FIRSTHDR(&header);
+				cmsg->cmsg_level = SOL_SOCKET;
+				cmsg->cmsg_type = SCM_RIGHTS;
+				cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+				std::memcpy(CMSG_DATA(cmsg), &descriptor, sizeof(int));
+			}
+			
+			if (::sendmsg(client.socket, &header, MSG_DONTWAIT | MSG_NOSIGNAL) == -1) {
+				if (errno != EAGAIN && errno != EWOULDBLOCK) {
+					disconnect(client);
+				}
+				
+				return false;
+			}
+			
+			return true;
+		}
+		
+		void FrameServer::disconnect(Client & client)
+		{
+			if (client.socket == -1) return;
+			
+			Console::info("Frame server disconnected client", client.socket);
+			
+			::close(client.socket);
+			client.socket = -1;
+			
+			// Everything the client was holding is implicitly released:
+			for (std::size_t slot = 0; slot < _slot_count; slot += 1) {
+				if (client.holding[slot]) {
+					client.holding[slot] = false;
+					_holders[slot] -= 1;
+				}
+			}
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,129 @@
+//
+//  FrameServer.hpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#if defined(__linux__)
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		// Publishes frames to other processes on the same host through a ring of slots in a single memfd, with a Unix socket for control. Each client receives the memfd once when it connects, and then a FRAME message per published frame. A slot is not reused until every client which was sent it has released it, which acts as the release fence. Nothing here ever blocks: clients which fall behind simply miss frames.
+		class FrameServer
+		{
+		public:
+			// The messages exchanged over the socket, which is SOCK_SEQPACKET so that message boundaries are preserved.
+			enum class MessageType : std::uint32_t {
+				// Sent by the server when a client connects, along with the memfd. The slot size and count describe the layout of the memfd.
+				LAYOUT = 1,
+				
+				// Sent by the server when a frame was written into a slot.
+				FRAME = 2,
+				
+				// Sent by a client once it has finished reading a slot.
+				RELEASE = 3,
+			};
+			
+			struct Message
+			{
+				MessageType type;
+				std::uint32_t slot;
+				std::uint64_t serial;
+				
+				// The layout of the frame (or the memfd, for LAYOUT).
+				std::uint32_t width, height;
+				std::uint32_t format;
+				std::uint32_t slot_count;
+				std::uint64_t slot_size;
+				std::uint64_t offset;
+				std::uint64_t row_pitch;
+				std::uint64_t size;
+			};
+			
+			// A frame to publish, e.g. from a FrameReadback capture. The format is a VkFormat.
+			struct Frame
+			{
+				std::uint64_t serial;
+				std::uint32_t width, height;
+				std::uint32_t format;
+				
+				const void * data;
+				std::uint64_t row_pitch;
+				std::uint64_t size;
+			};
+			
+			// Listen on the given path, which is replaced if it already exists. The slot size must accommodate the largest frame which will be published.
+			FrameServer(const std::string & path, std::uint64_t slot_size, std::size_t slot_count = 3);
+			virtual ~FrameServer();
+			
+			FrameServer(const FrameServer &) = delete;
+			
+			const std::string & path() const noexcept {return _path;}
+			std::uint64_t slot_size() const noexcept {return _slot_size;}
+			std::size_t slot_count() const noexcept {return _slot_count;}
+			
+			// The listening socket, for integrating with an event loop.
+			int descriptor() const noexcept {return _socket;}
+			
+			std::size_t clients() const noexcept {return _clients.size();}
+			
+			// The number of frames which were published, and dropped because every slot was still held by a client.
+			std::size_t published() const noexcept {return _published;}
+			std::size_t dropped() const noexcept {return _dropped;}
+			
+			// Accept new clients, process release messages and drop clients which disconnected.
+			void update();
+			
+			// Copy the frame into a free slot and notify every client. Returns false if there were no clients or no free slot.
+			bool publish(const Frame & frame);
+			
+		protected:
+			struct Client
+			{
+				int socket;
+				
+				// The slots this client was sent and has not yet released.
+				std::vector<bool> holding;
+			};
+			
+			void accept_clients();
+			bool receive(Client & client);
+			bool send(Client & client, const Message & message, int descriptor = -1);
+			void disconnect(Client & client);
+			
+			// Disconnect every client and release the socket and memory.
+			void close();
+			
+		private:
+			std::string _path;
+			
+			std::uint64_t _slot_size;
+			std::size_t _slot_count;
+			
+			int _socket = -1;
+			int _memory = -1;
+			std::uint8_t * _data = nullptr;
+			
+			// The number of clients holding each slot.
+			std::vector<std::size_t> _holders;
+			std::size_t _next = 0;
+			
+			std::vector<Client> _clients;
+			
+			std::size_t _published = 0;
+			std::size_t _dropped = 0;
+		};
+	}
+}
+
+#endif
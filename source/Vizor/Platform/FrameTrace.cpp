@@ -0,0 +1,155 @@
+//
+//  FrameTrace.cpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "FrameTrace.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		static void write_string(std::ostream & output, const char * string)
+		{
+			output << '"';
+			
+			for (auto character = string; *character; character += 1) {
+				if (*character == '"' || *character == '\\') {
+					output << '\\';
+				}
+				
+				output << *character;
+			}
+			
+			output << '"';
+		}
+		
+		static void write_microseconds(std::ostream & output, std::uint64_t nanoseconds)
+		{
+			output << (nanoseconds / 1000) << '.' << char('0' + (nanoseconds / 100) % 10) << char('0' + (nanoseconds / 10) % 10) << char('0' + nanoseconds % 10);
+		}
+		
+		FrameTrace::FrameTrace(std::size_t capacity) : _epoch(Clock::now()), _capacity(capacity), _entries(new Entry[capacity])
+		{
+			if (capacity == 0) {
+				throw std::invalid_argument("Frame trace requires a capacity of at least one span!");
+			}
+		}
+		
+		FrameTrace::~FrameTrace()
+		{
+		}
+		
+		std::uint64_t FrameTrace::now() const
+		{
+			return time_of(Clock::now());
+		}
+		
+		std::uint64_t FrameTrace::time_of(Clock::time_point time_point) const
+		{
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(time_point - _epoch).count();
+		}
+		
+		std::uint32_t FrameTrace::current_track()
+		{
+			static std::atomic<std::uint32_t> next_track{GPU_TRACK + 1};
+			thread_local std::uint32_t track = next_track.fetch_add(1, std::memory_order_relaxed);
+			
+			return track;
+		}
+		
+		void FrameTrace::record(const Span & span)
+		{
+			auto index = _next.fetch_add(1, std::memory_order_relaxed);
+			auto & entry = _entries[index % _capacity];
+			
+			// Readers discard the entry while the sequence is odd, or if it changes while they copy it:
+			entry.sequence.store(index * 2 + 1, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+			
+			entry.name.store(span.name, std::memory_order_relaxed);
+			entry.frame.store(span.frame, std::memory_order_relaxed);
+			entry.begin.store(span.begin, std::memory_order_relaxed);
+			entry.end.store(span.end, std::memory_order_relaxed);
+			entry.track.store(span.track, std::memory_order_relaxed);
+			
+			entry.sequence.store(index * 2 + 2, std::memory_order_release);
+		}
+		
+		std::vector<FrameTrace::Span> FrameTrace::spans() const
+		{
+			std::vector<Span> spans;
+			
+			auto next = _next.load(std::memory_order_acquire);
+			auto first = next > _capacity ? next - _capacity : 0;
+			
+			spans.reserve(next - first);
+			
+			for (auto index = first; index < next; index += 1) {
+				auto & entry = _entries[index % _capacity];
+				
+				auto sequence = entry.sequence.load(std::memory_order_acquire);
+				if (sequence != index * 2 + 2) continue;
+				
+				Span span = {
+					entry.name.load(std::memory_order_relaxed),
+					entry.frame.load(std::memory_order_relaxed),
+					entry.begin.load(std::memory_order_relaxed),
+					entry.end.load(std::memory_order_relaxed),
+					entry.track.load(std::memory_order_relaxed),
+				};
+				
+				std::atomic_thread_fence(std::memory_order_acquire);
+				if (entry.sequence.load(std::memory_order_relaxed) != sequence) continue;
+				
+				spans.push_back(span);
+			}
+			
+			return spans;
+		}
+		
+		std::uint64_t FrameTrace::percentile(const char * name, double fraction) const
+		{
+			std::vector<std::uint64_t> durations;
+			
+			for (auto & span : spans()) {
+				if (std::strcmp(span.name, name) == 0) {
+					durations.push_back(span.duration());
+				}
+			}
+			
+			if (durations.empty()) return 0;
+			
+			auto index = static_cast<std::size_t>(std::round(std::clamp(fraction, 0.0, 1.0) * (durations.size() - 1)));
+			std::nth_element(durations.begin(), durations.begin() + index, durations.end());
+			
+			return durations[index];
+		}
+		
+		void FrameTrace::write(std::ostream & output) const
+		{
+			output << "{\"traceEvents\":[";
+			output << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << GPU_TRACK << ",\"args\":{\"name\":\"GPU\"}}";
+			
+			for (auto & span : spans()) {
+				output << ",\n{\"name\":";
+				write_string(output, span.name);
+				output << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << span.track << ",\"ts\":";
+				write_microseconds(output, span.begin);
+				output << ",\"dur\":";
+				write_microseconds(output, span.duration());
+				output << ",\"args\":{\"frame\":" << span.frame << "}}";
+			}
+			
+			output << "]}\n";
+		}
+	}
+}
@@ -0,0 +1,113 @@
+//
+//  FrameTrace.hpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		// Records CPU and GPU spans into a fixed size ring, which can be recorded into from any thread without locking. The most recent spans can be exported as Chrome trace event JSON (chrome://tracing) or summarised as percentiles.
+		class FrameTrace
+		{
+		public:
+			typedef std::chrono::steady_clock Clock;
+			
+			// GPU spans are recorded on this track, while CPU spans use one track per thread.
+			static constexpr std::uint32_t GPU_TRACK = 0;
+			
+			struct Span
+			{
+				// Must outlive the trace, e.g. a string literal.
+				const char * name;
+				
+				// The serial of the frame which the span belongs to.
+				std::uint64_t frame;
+				
+				// Nanoseconds since the trace was created.
+				std::uint64_t begin;
+				std::uint64_t end;
+				
+				std::uint32_t track;
+				
+				std::uint64_t duration() const noexcept {return end - begin;}
+			};
+			
+			// Records a CPU span from construction until destruction. Does nothing if the trace is null.
+			class Scope
+			{
+			public:
+				Scope(FrameTrace * trace, const char * name, std::uint64_t frame = 0) : _trace(trace), _name(name), _frame(frame), _begin(trace ? trace->now() : 0) {}
+				~Scope() {if (_trace) _trace->record(_name, _frame, _begin, _trace->now());}
+				
+				Scope(const Scope &) = delete;
+				
+			private:
+				FrameTrace * _trace;
+				const char * _name;
+				std::uint64_t _frame;
+				std::uint64_t _begin;
+			};
+			
+			FrameTrace(std::size_t capacity = 4096);
+			~FrameTrace();
+			
+			FrameTrace(const FrameTrace &) = delete;
+			
+			std::size_t capacity() const noexcept {return _capacity;}
+			
+			// Nanoseconds since the trace was created.
+			std::uint64_t now() const;
+			std::uint64_t time_of(Clock::time_point time_point) const;
+			
+			// The track of the calling thread.
+			static std::uint32_t current_track();
+			
+			// Record a span, overwriting the oldest one if the ring is full.
+			void record(const Span & span);
+			void record(const char * name, std::uint64_t frame, std::uint64_t begin, std::uint64_t end) {record({name, frame, begin, end, current_track()});}
+			
+			// A snapshot of the spans in the ring, oldest first. Spans which are being overwritten while taking the snapshot are skipped.
+			std::vector<Span> spans() const;
+			
+			// The duration in nanoseconds, at the given fraction (e.g. 0.99), of the recorded spans with the given name. Zero if there are none.
+			std::uint64_t percentile(const char * name, double fraction) const;
+			
+			// Write the spans as Chrome trace event JSON.
+			void write(std::ostream & output) const;
+			
+		private:
+			// The fields are atomic so that a reader racing with a writer sees a torn span, which it discards, rather than undefined behaviour.
+			struct Entry
+			{
+				// Odd while being written, otherwise twice (index + 1) of the span it holds.
+				std::atomic<std::uint64_t> sequence{0};
+				
+				std::atomic<const char *> name{nullptr};
+				std::atomic<std::uint64_t> frame{0};
+				std::atomic<std::uint64_t> begin{0};
+				std::atomic<std::uint64_t> end{0};
+				std::atomic<std::uint32_t> track{0};
+			};
+			
+			Clock::time_point _epoch;
+			
+			std::size_t _capacity;
+			std::unique_ptr<Entry[]> _entries;
+			
+			std::atomic<std::uint64_t> _next{0};
+		};
+	}
+}
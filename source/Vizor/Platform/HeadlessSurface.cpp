@@ -0,0 +1,38 @@
+//
+//  HeadlessSurface.cpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "HeadlessSurface.hpp"
+
+#if defined(VK_EXT_headless_surface)
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		HeadlessSurface::~HeadlessSurface()
+		{
+		}
+		
+		Extensions HeadlessSurface::instance_extensions()
+		{
+			return {
+				VK_KHR_SURFACE_EXTENSION_NAME,
+				VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME,
+			};
+		}
+		
+		void HeadlessSurface::setup_surface()
+		{
+			auto surface_create_info = vk::HeadlessSurfaceCreateInfoEXT();
+			
+			_surface = _instance.createHeadlessSurfaceEXTUnique(surface_create_info, _allocation_callbacks);
+		}
+	}
+}
+
+#endif
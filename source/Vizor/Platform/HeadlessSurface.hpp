@@ -0,0 +1,35 @@
+//
+//  HeadlessSurface.hpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Surface.hpp"
+
+#if defined(VK_EXT_headless_surface)
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		// A surface which is not backed by any display server, using VK_EXT_headless_surface. The instance must be created with the extensions given by `instance_extensions()`.
+		class HeadlessSurface : public Surface
+		{
+		public:
+			HeadlessSurface(const Context & context) : Surface(context) {}
+			virtual ~HeadlessSurface();
+			
+			// Headless surfaces have no current extent, so the swapchain is created with the extent given to the SwapchainController.
+			static Extensions instance_extensions();
+			
+		protected:
+			virtual void setup_surface() override;
+		};
+	}
+}
+
+#endif
@@ -0,0 +1,181 @@
+//
+//  OffscreenController.cpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "OffscreenController.hpp"
+
+#include <Logger/Console.hpp>
+
+#include <stdexcept>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		using namespace Logger;
+		
+		OffscreenController::OffscreenController(const GraphicsContext & graphics_context, vk::Queue queue, std::uint32_t queue_family_index, vk::Extent2D extent, std::size_t image_count, vk::Format format, vk::ImageUsageFlags image_usage, std::uint32_t api_version) : RenderTarget(SurfaceContext(graphics_context, queue, nullptr, api_version), {queue_family_index, queue_family_index}, extent), _image_count(image_count), _image_usage(image_usage)
+		{
+			if (image_count == 0) {
+				throw std::invalid_argument("Offscreen controller requires at least one image!");
+			}
+			
+			// As with a swapchain, fail up front rather than when the images are created or first used:
+			if (!supports_image_usage(_physical_device, _api_version, format, image_usage)) {
+				throw std::runtime_error("Format " + vk::to_string(format) + " does not support image usage " + vk::to_string(image_usage) + "!");
+			}
+			
+			_surface_format = vk::SurfaceFormatKHR(format, vk::ColorSpaceKHR::eSrgbNonlinear);
+			
+			setup_images();
+		}
+		
+		OffscreenController::~OffscreenController()
+		{
+			// The views must be destroyed before the images they refer to:
+			_buffers.clear();
+		}
+		
+		void OffscreenController::resize(vk::Extent2D extent)
+		{
+			Changes changes;
+			changes.extent = extent != _extent;
+			
+			// In flight frames may still be using the old images, so defer destruction until they have completed:
+			_retirement_queue.retire(RetiredImages{std::move(_memory), std::move(_images), std::move(_buffers)});
+			
+			_extent = extent;
+			
+			setup_images();
+			
+			notify(changes);
+		}
+		
+		RenderTarget::Status OffscreenController::acquire(vk::Semaphore semaphore, vk::Fence fence, std::uint64_t timeout, std::uint32_t & image_index)
+		{
+			// Nothing to render to, exactly like a minimised window:
+			if (_extent.width == 0 || _extent.height == 0) {
+				return Status::SUSPENDED;
+			}
+			
+			image_index = _next_image;
+			_next_image = (_next_image + 1) % _buffers.size();
+			
+			auto submit_info = vk::SubmitInfo();
+			
+			if (semaphore) {
+				submit_info
+					.setSignalSemaphoreCount(1)
+					.setPSignalSemaphores(&semaphore);
+			}
+			
+			if (semaphore || fence) {
+				_present_queue.submit(submit_info, fence);
+			}
+			
+			return Status::OK;
+		}
+		
+		RenderTarget::Status OffscreenController::present(vk::Queue queue, vk::SwapchainKHR swapchain, vk::Semaphore wait_semaphore, std::uint32_t image_index)
+		{
+			if (wait_semaphore) {
+				vk::PipelineStageFlags wait_stages[] = {vk::PipelineStageFlagBits::eAllCommands};
+				
+				auto submit_info = vk::SubmitInfo()
+					.setWaitSemaphoreCount(1)
+					.setPWaitSemaphores(&wait_semaphore)
+					.setPWaitDstStageMask(wait_stages);
+				
+				queue.submit(submit_info, nullptr);
+			}
+			
+			return Status::OK;
+		}
+		
+		std::uint32_t OffscreenController::find_memory_type(std::uint32_t memory_type_bits, vk::MemoryPropertyFlags properties) const
+		{
+			auto memory_properties = _physical_device.getMemoryProperties();
+			
+			for (std::uint32_t index = 0; index < memory_properties.memoryTypeCount; index += 1) {
+				if ((memory_type_bits & (1 << index)) && (memory_properties.memoryTypes[index].propertyFlags & properties) == properties) {
+					return index;
+				}
+			}
+			
+			throw std::runtime_error("Could not find device local memory!");
+		}
+		
+		void OffscreenController::setup_images()
+		{
+			using S = vk::ComponentSwizzle;
+			
+			Console::info("Setting up", _image_count, "offscreen images with extent", _extent.width, "x", _extent.height);
+			
+			_buffers.resize(0);
+			_images.resize(0);
+			_memory.resize(0);
+			_next_image = 0;
+			
+			if (_extent.width == 0 || _extent.height == 0) {
+				_generation += 1;
+				return;
+			}
+			
+			auto image_create_info = vk::ImageCreateInfo()
+				.setImageType(vk::ImageType::e2D)
+				.setFormat(_surface_format.format)
+				.setExtent({_extent.width, _extent.height, 1})
+				.setMipLevels(1)
+				.setArrayLayers(1)
+				.setSamples(vk::SampleCountFlagBits::e1)
+				.setTiling(vk::ImageTiling::eOptimal)
+				.setUsage(_image_usage)
+				.setSharingMode(vk::SharingMode::eExclusive)
+				.setInitialLayout(vk::ImageLayout::eUndefined);
+			
+			auto subresource_range = vk::ImageSubresourceRange()
+				.setAspectMask(vk::ImageAspectFlagBits::eColor)
+				.setBaseMipLevel(0).setLevelCount(1)
+				.setBaseArrayLayer(0).setLayerCount(1);
+			
+			// Views are only needed to use the images as attachments or from shaders:
+			auto view_usage = vk::ImageUsageFlagBits::eColorAttachment | vk::ImageUsageFlagBits::eStorage | vk::ImageUsageFlagBits::eSampled | vk::ImageUsageFlagBits::eInputAttachment;
+			
+			for (std::size_t index = 0; index < _image_count; index += 1) {
+				auto image = _device.createImageUnique(image_create_info, _allocation_callbacks);
+				
+				auto memory_requirements = _device.getImageMemoryRequirements(image.get());
+				
+				auto memory_allocate_info = vk::MemoryAllocateInfo()
+					.setAllocationSize(memory_requirements.size)
+					.setMemoryTypeIndex(find_memory_type(memory_requirements.memoryTypeBits, vk::MemoryPropertyFlagBits::eDeviceLocal));
+				
+				auto memory = _device.allocateMemoryUnique(memory_allocate_info, _allocation_callbacks);
+				_device.bindImageMemory(image.get(), memory.get(), 0);
+				
+				vk::UniqueImageView image_view;
+				
+				if (_image_usage & view_usage) {
+					auto image_view_create_info = vk::ImageViewCreateInfo()
+						.setImage(image.get())
+						.setViewType(vk::ImageViewType::e2D)
+						.setFormat(_surface_format.format)
+						.setComponents({S::eIdentity, S::eIdentity, S::eIdentity, S::eIdentity})
+						.setSubresourceRange(subresource_range);
+					
+					image_view = _device.createImageViewUnique(image_view_create_info, _allocation_callbacks);
+				}
+				
+				_buffers.push_back({image.get(), std::move(image_view)});
+				_images.push_back(std::move(image));
+				_memory.push_back(std::move(memory));
+			}
+			
+			_generation += 1;
+		}
+	}
+}
@@ -0,0 +1,60 @@
+//
+//  OffscreenController.hpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "RenderTarget.hpp"
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		// A render target backed by device local images rather than a swapchain, for headless rendering, tests and capture. Images are handed out round robin, and "presenting" simply releases the image once rendering has finished. Render passes should leave the images in a layout other than ePresentSrcKHR, e.g. eTransferSrcOptimal for readback.
+		class OffscreenController : public RenderTarget
+		{
+		public:
+			OffscreenController(const GraphicsContext & graphics_context, vk::Queue queue, std::uint32_t queue_family_index, vk::Extent2D extent, std::size_t image_count = 3, vk::Format format = vk::Format::eB8G8R8A8Unorm, vk::ImageUsageFlags image_usage = vk::ImageUsageFlagBits::eColorAttachment | vk::ImageUsageFlagBits::eTransferSrc, std::uint32_t api_version = VK_API_VERSION_1_0);
+			virtual ~OffscreenController();
+			
+			std::size_t image_count() const noexcept {return _image_count;}
+			vk::ImageUsageFlags image_usage() const noexcept {return _image_usage;}
+			
+			// Recreate the images with a new extent. The previous images are retired.
+			virtual void resize(vk::Extent2D extent) override;
+			
+			// Hand out the next image round robin. The semaphore and fence are signalled by an empty submission, so the frame waits on them exactly as it would for a swapchain.
+			virtual Status acquire(vk::Semaphore semaphore, vk::Fence fence, std::uint64_t timeout, std::uint32_t & image_index) override;
+			
+			// Consume the semaphore with an empty submission, as there is nothing to present.
+			virtual Status present(vk::Queue queue, vk::SwapchainKHR swapchain, vk::Semaphore wait_semaphore, std::uint32_t image_index) override;
+			
+		protected:
+			std::uint32_t find_memory_type(std::uint32_t memory_type_bits, vk::MemoryPropertyFlags properties) const;
+			
+			virtual void setup_images();
+			
+		private:
+			std::size_t _image_count;
+			vk::ImageUsageFlags _image_usage;
+			
+			// Destroyed in reverse order, so the images before the memory bound to them:
+			std::vector<vk::UniqueDeviceMemory> _memory;
+			std::vector<vk::UniqueImage> _images;
+			
+			std::uint32_t _next_image = 0;
+			
+			struct RetiredImages
+			{
+				// Destroyed in reverse order: the views, then the images, then their memory.
+				std::vector<vk::UniqueDeviceMemory> memory;
+				std::vector<vk::UniqueImage> images;
+				std::vector<Buffer> buffers;
+			};
+		};
+	}
+}
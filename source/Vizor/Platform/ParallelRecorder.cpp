@@ -0,0 +1,77 @@
+//
+//  ParallelRecorder.cpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "ParallelRecorder.hpp"
+
+#include <algorithm>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		ParallelRecorder::ParallelRecorder(std::size_t thread_count) : _worker_pool(thread_count)
+		{
+		}
+		
+		ParallelRecorder::~ParallelRecorder()
+		{
+		}
+		
+		void ParallelRecorder::record(FramePresenter::Frame & frame, vk::RenderPass render_pass, std::uint32_t subpass, vk::Framebuffer framebuffer, std::size_t count, const Task & task, vk::CommandBufferInheritanceInfo inheritance_info)
+		{
+			if (count == 0) return;
+			
+			// Each part has its own command pool, as pools can't be used by more than one thread at a time:
+			auto parts = std::min({count, _worker_pool.size(), frame.command_pools->thread_count()});
+			auto part_size = (count + parts - 1) / parts;
+			
+			inheritance_info
+				.setRenderPass(render_pass)
+				.setSubpass(subpass)
+				.setFramebuffer(framebuffer);
+			
+			auto begin_info = vk::CommandBufferBeginInfo()
+				.setFlags(vk::CommandBufferUsageFlagBits::eRenderPassContinue | vk::CommandBufferUsageFlagBits::eOneTimeSubmit)
+				.setPInheritanceInfo(&inheritance_info);
+			
+			std::vector<std::future<vk::CommandBuffer>> futures;
+			futures.reserve(parts);
+			
+			for (std::size_t part = 0; part < parts; part += 1) {
+				auto begin = part * part_size;
+				auto end = std::min(begin + part_size, count);
+				
+				if (begin >= end) break;
+				
+				futures.push_back(_worker_pool.async([&, part, begin, end]{
+					auto command_buffer = frame.command_pools->allocate(part, vk::CommandBufferLevel::eSecondary);
+					
+					command_buffer.begin(begin_info);
+					task(command_buffer, begin, end);
+					command_buffer.end();
+					
+					return command_buffer;
+				}));
+			}
+			
+			// Wait for every part before propagating any failure, as the tasks refer to the frame and this stack frame:
+			for (auto & future : futures) {
+				future.wait();
+			}
+			
+			std::vector<vk::CommandBuffer> command_buffers;
+			command_buffers.reserve(futures.size());
+			
+			for (auto & future : futures) {
+				command_buffers.push_back(future.get());
+			}
+			
+			frame.command_buffer.executeCommands(command_buffers);
+		}
+	}
+}
@@ -0,0 +1,41 @@
+//
+//  ParallelRecorder.hpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "FramePresenter.hpp"
+#include "WorkerPool.hpp"
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		// Records a render pass across several threads into secondary command buffers, which are then executed by the frame's primary command buffer.
+		class ParallelRecorder
+		{
+		public:
+			// Records the items in the range [begin, end) into a secondary command buffer which has already begun. Dynamic state such as the viewport and scissor is not inherited, so it must be set again.
+			typedef std::function<void(vk::CommandBuffer command_buffer, std::size_t begin, std::size_t end)> Task;
+			
+			// A count of zero uses one thread per hardware thread.
+			ParallelRecorder(std::size_t thread_count = 0);
+			virtual ~ParallelRecorder();
+			
+			ParallelRecorder(const ParallelRecorder &) = delete;
+			
+			std::size_t thread_count() const noexcept {return _worker_pool.size();}
+			
+			// Split count items across threads, each recording into a secondary command buffer from its own command pool, and execute them in order in the frame's primary command buffer. The render pass must have been begun with vk::SubpassContents::eSecondaryCommandBuffers, and nothing else may record into the frame until this returns. The work is split into at most as many parts as the frame has command pools.
+			// Queries which are active in the primary command buffer must be declared in the inheritance info, e.g. from FrameCounters::inheritance_info(). Its render pass, subpass and framebuffer are filled in.
+			void record(FramePresenter::Frame & frame, vk::RenderPass render_pass, std::uint32_t subpass, vk::Framebuffer framebuffer, std::size_t count, const Task & task, vk::CommandBufferInheritanceInfo inheritance_info = vk::CommandBufferInheritanceInfo());
+			
+		protected:
+			WorkerPool _worker_pool;
+		};
+	}
+}
@@ -0,0 +1,103 @@
+//
+//  PipelineBuilder.cpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "PipelineBuilder.hpp"
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		PipelineBuilder::~PipelineBuilder()
+		{
+		}
+		
+		std::future<vk::UniquePipeline> PipelineBuilder::build(GraphicsPipelineDescription description)
+		{
+			return _worker_pool.async([this, description = std::move(description)]{
+				return create_graphics_pipeline(description);
+			});
+		}
+		
+		std::future<vk::UniquePipeline> PipelineBuilder::build(const vk::ComputePipelineCreateInfo & compute_pipeline_create_info)
+		{
+			return _worker_pool.async([this, compute_pipeline_create_info]{
+				return _device.createComputePipelineUnique(_pipeline_cache, compute_pipeline_create_info, _allocation_callbacks);
+			});
+		}
+		
+		vk::UniquePipeline PipelineBuilder::create_graphics_pipeline(const GraphicsPipelineDescription & description) const
+		{
+			// Reserved up front, as the stages point into it:
+			std::vector<vk::SpecializationInfo> specialization_infos;
+			specialization_infos.reserve(description.stages.size());
+			
+			std::vector<vk::PipelineShaderStageCreateInfo> stages;
+			stages.reserve(description.stages.size());
+			
+			for (auto & stage : description.stages) {
+				auto stage_create_info = vk::PipelineShaderStageCreateInfo()
+					.setStage(stage.stage)
+					.setModule(stage.module)
+					.setPName(stage.entry_point.c_str());
+				
+				if (!stage.specialization_entries.empty()) {
+					specialization_infos.push_back(vk::SpecializationInfo()
+						.setMapEntryCount(stage.specialization_entries.size())
+						.setPMapEntries(stage.specialization_entries.data())
+						.setDataSize(stage.specialization_data.size())
+						.setPData(stage.specialization_data.data())
+					);
+					
+					stage_create_info.setPSpecializationInfo(&specialization_infos.back());
+				}
+				
+				stages.push_back(stage_create_info);
+			}
+			
+			auto vertex_input_state_create_info = vk::PipelineVertexInputStateCreateInfo()
+				.setVertexBindingDescriptionCount(description.vertex_bindings.size())
+				.setPVertexBindingDescriptions(description.vertex_bindings.data())
+				.setVertexAttributeDescriptionCount(description.vertex_attributes.size())
+				.setPVertexAttributeDescriptions(description.vertex_attributes.data());
+			
+			// The counts are required even though the viewport and scissor are dynamic:
+			auto viewport_state_create_info = vk::PipelineViewportStateCreateInfo()
+				.setViewportCount(1)
+				.setScissorCount(1);
+			
+			auto color_blend_state_create_info = vk::PipelineColorBlendStateCreateInfo()
+				.setAttachmentCount(description.color_blend_attachments.size())
+				.setPAttachments(description.color_blend_attachments.data())
+				.setBlendConstants(description.blend_constants);
+			
+			std::vector<vk::DynamicState> dynamic_states = {vk::DynamicState::eViewport, vk::DynamicState::eScissor};
+			dynamic_states.insert(dynamic_states.end(), description.dynamic_states.begin(), description.dynamic_states.end());
+			
+			auto dynamic_state_create_info = vk::PipelineDynamicStateCreateInfo()
+				.setDynamicStateCount(dynamic_states.size())
+				.setPDynamicStates(dynamic_states.data());
+			
+			auto graphics_pipeline_create_info = vk::GraphicsPipelineCreateInfo()
+				.setStageCount(stages.size())
+				.setPStages(stages.data())
+				.setPVertexInputState(&vertex_input_state_create_info)
+				.setPInputAssemblyState(&description.input_assembly)
+				.setPViewportState(&viewport_state_create_info)
+				.setPRasterizationState(&description.rasterization)
+				.setPMultisampleState(&description.multisample)
+				.setPDepthStencilState(&description.depth_stencil)
+				.setPColorBlendState(&color_blend_state_create_info)
+				.setPDynamicState(&dynamic_state_create_info)
+				.setLayout(description.layout)
+				.setRenderPass(description.render_pass)
+				.setSubpass(description.subpass);
+			
+			return _device.createGraphicsPipelineUnique(_pipeline_cache, graphics_pipeline_create_info, _allocation_callbacks);
+		}
+	}
+}
@@ -0,0 +1,93 @@
+//
+//  PipelineBuilder.hpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "WorkerPool.hpp"
+
+#include <Vizor/GraphicsContext.hpp>
+
+#include <array>
+#include <string>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		// A shader stage which owns its entry point name and specialization constants, unlike vk::PipelineShaderStageCreateInfo.
+		struct GraphicsPipelineStage
+		{
+			vk::ShaderStageFlagBits stage;
+			vk::ShaderModule module;
+			std::string entry_point = "main";
+			
+			std::vector<vk::SpecializationMapEntry> specialization_entries;
+			std::vector<std::uint8_t> specialization_data;
+		};
+		
+		// A self-contained description of a graphics pipeline, which can be copied to another thread. Unlike vk::GraphicsPipelineCreateInfo it owns all of its state, except for the shader modules, layout and render pass which must outlive the build. The state structures must not chain anything through pNext.
+		struct GraphicsPipelineDescription
+		{
+			std::vector<GraphicsPipelineStage> stages;
+			
+			std::vector<vk::VertexInputBindingDescription> vertex_bindings;
+			std::vector<vk::VertexInputAttributeDescription> vertex_attributes;
+			
+			vk::PipelineInputAssemblyStateCreateInfo input_assembly = vk::PipelineInputAssemblyStateCreateInfo()
+				.setTopology(vk::PrimitiveTopology::eTriangleList);
+			
+			vk::PipelineRasterizationStateCreateInfo rasterization = vk::PipelineRasterizationStateCreateInfo()
+				.setPolygonMode(vk::PolygonMode::eFill)
+				.setCullMode(vk::CullModeFlagBits::eNone)
+				.setLineWidth(1.0);
+			
+			vk::PipelineMultisampleStateCreateInfo multisample = vk::PipelineMultisampleStateCreateInfo()
+				.setRasterizationSamples(vk::SampleCountFlagBits::e1);
+			
+			vk::PipelineDepthStencilStateCreateInfo depth_stencil;
+			
+			std::vector<vk::PipelineColorBlendAttachmentState> color_blend_attachments;
+			std::array<float, 4> blend_constants = {{0, 0, 0, 0}};
+			
+			// The viewport and scissor are always dynamic, so that pipelines don't depend on the swapchain extent. These are in addition to them.
+			std::vector<vk::DynamicState> dynamic_states;
+			
+			vk::PipelineLayout layout;
+			vk::RenderPass render_pass;
+			std::uint32_t subpass = 0;
+		};
+		
+		// Compiles pipelines on a pool of worker threads against a shared pipeline cache.
+		class PipelineBuilder : public GraphicsContext
+		{
+		public:
+			// A worker count of zero uses one thread per hardware thread.
+			PipelineBuilder(const GraphicsContext & graphics_context, vk::PipelineCache pipeline_cache, std::size_t worker_count = 0) : GraphicsContext(graphics_context), _pipeline_cache(pipeline_cache), _worker_pool(worker_count) {}
+			virtual ~PipelineBuilder();
+			
+			PipelineBuilder(const PipelineBuilder &) = delete;
+			
+			std::size_t worker_count() const noexcept {return _worker_pool.size();}
+			
+			// Start compiling the given pipeline. Any error is rethrown from the future's get().
+			std::future<vk::UniquePipeline> build(GraphicsPipelineDescription description);
+			
+			// The stage's name and specialization info must outlive the build.
+			std::future<vk::UniquePipeline> build(const vk::ComputePipelineCreateInfo & compute_pipeline_create_info);
+			
+		protected:
+			vk::UniquePipeline create_graphics_pipeline(const GraphicsPipelineDescription & description) const;
+			
+			// Pipeline caches are internally synchronized, so every worker can compile against the same one.
+			vk::PipelineCache _pipeline_cache;
+			
+			// Declared last so that outstanding builds finish before anything else is destroyed.
+			WorkerPool _worker_pool;
+		};
+	}
+}
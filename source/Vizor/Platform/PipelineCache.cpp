@@ -0,0 +1,163 @@
+//
+//  PipelineCache.cpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "PipelineCache.hpp"
+
+#include <Logger/Console.hpp>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		using namespace Logger;
+		
+		// The cache header is always written least significant byte first:
+		static std::uint32_t read_uint32(const std::uint8_t * data)
+		{
+			return data[0] | (data[1] << 8) | (data[2] << 16) | (std::uint32_t(data[3]) << 24);
+		}
+		
+		PipelineCache::PipelineCache(const GraphicsContext & graphics_context, const std::string & path) : GraphicsContext(graphics_context), _path(path)
+		{
+			auto data = load();
+			
+			if (!data.empty() && !validate(data, _physical_device.getProperties())) {
+				Console::warn("Discarding pipeline cache", _path, "which was created by a different device or driver.");
+				data.clear();
+			}
+			
+			auto pipeline_cache_create_info = vk::PipelineCacheCreateInfo()
+				.setInitialDataSize(data.size())
+				.setPInitialData(data.data());
+			
+			_pipeline_cache = _device.createPipelineCacheUnique(pipeline_cache_create_info, _allocation_callbacks);
+			_saved_size = data.size();
+			
+			Console::info("Loaded pipeline cache", _path, "with", data.size(), "bytes.");
+		}
+		
+		PipelineCache::~PipelineCache()
+		{
+			// Failing to save the cache only costs compile time on the next run, so it must not escape the destructor:
+			try {
+				save_if_changed();
+			} catch (std::exception & error) {
+				Console::error("Could not save pipeline cache", _path, error.what());
+			}
+		}
+		
+		// Write all of the data to the given file descriptor and flush it to disk.
+		static bool write_all(int descriptor, const std::vector<std::uint8_t> & data)
+		{
+			std::size_t offset = 0;
+			
+			while (offset < data.size()) {
+				auto result = ::write(descriptor, data.data() + offset, data.size() - offset);
+				
+				if (result == -1) {
+					if (errno == EINTR) continue;
+					return false;
+				}
+				
+				offset += result;
+			}
+			
+			return ::fsync(descriptor) == 0;
+		}
+		
+		bool PipelineCache::save()
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			
+			auto data = _device.getPipelineCacheData(_pipeline_cache.get());
+			
+			// Every process (and thread) gets its own temporary file, so concurrent saves never write into the same one:
+			std::string temporary_path = _path + ".XXXXXX";
+			int descriptor = ::mkstemp(&temporary_path[0]);
+			
+			if (descriptor == -1) {
+				Console::warn("Could not create temporary pipeline cache", temporary_path, std::strerror(errno));
+				
+				return false;
+			}
+			
+			bool written = write_all(descriptor, data);
+			
+			if (::close(descriptor) != 0) written = false;
+			
+			if (!written) {
+				Console::warn("Could not write pipeline cache", temporary_path, std::strerror(errno));
+				std::remove(temporary_path.c_str());
+				
+				return false;
+			}
+			
+			if (std::rename(temporary_path.c_str(), _path.c_str()) != 0) {
+				Console::warn("Could not replace pipeline cache", _path, std::strerror(errno));
+				std::remove(temporary_path.c_str());
+				
+				return false;
+			}
+			
+			_saved_size = data.size();
+			
+			Console::info("Saved pipeline cache", _path, "with", data.size(), "bytes.");
+			
+			return true;
+		}
+		
+		bool PipelineCache::save_if_changed()
+		{
+			std::size_t size = 0;
+			
+			_device.getPipelineCacheData(_pipeline_cache.get(), &size, nullptr);
+			
+			// Pipeline caches only ever grow, so the size is a good enough indication of new content:
+			if (size == _saved_size) return true;
+			
+			return save();
+		}
+		
+		bool PipelineCache::validate(const std::vector<std::uint8_t> & data, const vk::PhysicalDeviceProperties & properties)
+		{
+			// Header length, header version, vendor ID, device ID and the pipeline cache UUID:
+			const std::size_t HEADER_SIZE = 16 + VK_UUID_SIZE;
+			
+			if (data.size() < HEADER_SIZE) return false;
+			
+			auto header_length = read_uint32(data.data());
+			auto header_version = read_uint32(data.data() + 4);
+			
+			if (header_length < HEADER_SIZE || header_length > data.size()) return false;
+			if (header_version != VK_PIPELINE_CACHE_HEADER_VERSION_ONE) return false;
+			
+			if (read_uint32(data.data() + 8) != properties.vendorID) return false;
+			if (read_uint32(data.data() + 12) != properties.deviceID) return false;
+			
+			return std::memcmp(data.data() + 16, &properties.pipelineCacheUUID[0], VK_UUID_SIZE) == 0;
+		}
+		
+		std::vector<std::uint8_t> PipelineCache::load() const
+		{
+			std::ifstream input(_path, std::ios::binary);
+			
+			if (!input) return {};
+			
+			return std::vector<std::uint8_t>(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+		}
+	}
+}
@@ -0,0 +1,56 @@
+//
+//  PipelineCache.hpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include <Vizor/GraphicsContext.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <string>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		// A pipeline cache which persists to disk between runs. Cache data written by a different driver or device is discarded when loaded.
+		class PipelineCache : public GraphicsContext
+		{
+		public:
+			PipelineCache(const GraphicsContext & graphics_context, const std::string & path);
+			
+			// Saves the cache if it has changed.
+			virtual ~PipelineCache();
+			
+			PipelineCache(const PipelineCache &) = delete;
+			
+			const std::string & path() const noexcept {return _path;}
+			vk::PipelineCache pipeline_cache() const noexcept {return _pipeline_cache.get();}
+			
+			// Write the cache to disk atomically, by writing a uniquely named temporary file, syncing it and renaming it over the original. Returns false on failure.
+			bool save();
+			
+			// Save only if the cache has grown since it was loaded or last saved. Cheap enough to call periodically.
+			bool save_if_changed();
+			
+			// Whether the header matches the given device, so the driver won't be given stale or foreign data.
+			static bool validate(const std::vector<std::uint8_t> & data, const vk::PhysicalDeviceProperties & properties);
+			
+		protected:
+			
+			std::vector<std::uint8_t> load() const;
+			
+			std::string _path;
+			
+			// Serializes saving, which may happen from any thread. The pipeline cache itself is internally synchronized.
+			std::mutex _mutex;
+			vk::UniquePipelineCache _pipeline_cache;
+			std::atomic<std::size_t> _saved_size{0};
+		};
+	}
+}
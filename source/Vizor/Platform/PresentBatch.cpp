@@ -0,0 +1,113 @@
+//
+//  PresentBatch.cpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "PresentBatch.hpp"
+#include "SwapchainController.hpp"
+
+#include <algorithm>
+#include <exception>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		PresentBatch::PresentBatch()
+		{
+		}
+		
+		PresentBatch::~PresentBatch()
+		{
+		}
+		
+		void PresentBatch::submit(FramePresenter & frame_presenter, FramePresenter::Frame & frame)
+		{
+			if (std::find(_frame_presenters.begin(), _frame_presenters.end(), &frame_presenter) != _frame_presenters.end()) {
+				throw std::logic_error("Frame presenter already has a frame in this batch!");
+			}
+			
+			// Offscreen targets have nothing to present:
+			if (!frame.swapchain || !dynamic_cast<SwapchainController *>(&frame_presenter.render_target())) {
+				throw std::logic_error("Frame presenter does not render to a swapchain!");
+			}
+			
+			frame_presenter.submit(frame);
+			
+			_frame_presenters.push_back(&frame_presenter);
+			_wait_semaphores.push_back(frame.render_finished);
+			_swapchains.push_back(frame.swapchain);
+			_image_indices.push_back(frame.image_index);
+		}
+		
+		FramePresenter::Status PresentBatch::present()
+		{
+			auto status = FramePresenter::Status::OK;
+			
+			if (empty()) return status;
+			
+			// Whatever happens, including exceptions, the batch is empty afterwards so that the presenters can be used again:
+			struct Clear
+			{
+				PresentBatch & batch;
+				~Clear() {batch.clear();}
+			} guard{*this};
+			
+			_results.assign(_swapchains.size(), vk::Result::eSuccess);
+			
+			auto present_info = vk::PresentInfoKHR()
+				.setWaitSemaphoreCount(_wait_semaphores.size())
+				.setPWaitSemaphores(_wait_semaphores.data())
+				.setSwapchainCount(_swapchains.size())
+				.setPSwapchains(_swapchains.data())
+				.setPImageIndices(_image_indices.data())
+				.setPResults(_results.data());
+			
+			auto result = _frame_presenters.front()->present_queue().presentKHR(&present_info);
+			
+			// Errors such as device loss apply to the whole batch rather than any one swapchain, and none of the presenters can recover from them:
+			if (result != vk::Result::eSuccess && result != vk::Result::eSuboptimalKHR && result != vk::Result::eErrorOutOfDateKHR && result != vk::Result::eErrorSurfaceLostKHR) {
+				for (auto frame_presenter : _frame_presenters) {
+					frame_presenter->_status = FramePresenter::Status::SURFACE_LOST;
+				}
+				
+				throw vk::SystemError(vk::make_error_code(result), "vkQueuePresentKHR");
+			}
+			
+			// Update every presenter before rethrowing the first unexpected error (e.g. device lost), so none is left with a stale status:
+			std::exception_ptr error;
+			
+			for (std::size_t index = 0; index < _frame_presenters.size(); index += 1) {
+				auto frame_presenter = _frame_presenters[index];
+				
+				auto & swapchain_controller = static_cast<SwapchainController &>(frame_presenter->render_target());
+				
+				try {
+					frame_presenter->_status = swapchain_controller.status_for(_results[index]);
+				} catch (...) {
+					frame_presenter->_status = FramePresenter::Status::SURFACE_LOST;
+					if (!error) error = std::current_exception();
+				}
+				
+				if (status == FramePresenter::Status::OK) {
+					status = frame_presenter->_status;
+				}
+			}
+			
+			if (error) std::rethrow_exception(error);
+			
+			return status;
+		}
+		
+		void PresentBatch::clear()
+		{
+			_frame_presenters.clear();
+			_wait_semaphores.clear();
+			_swapchains.clear();
+			_image_indices.clear();
+		}
+	}
+}
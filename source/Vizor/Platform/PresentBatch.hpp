@@ -0,0 +1,44 @@
+//
+//  PresentBatch.hpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "FramePresenter.hpp"
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		// Presents frames from several swapchains on the same device with a single vkQueuePresentKHR, so that they flip together rather than drifting out of phase.
+		class PresentBatch
+		{
+		public:
+			PresentBatch();
+			virtual ~PresentBatch();
+			
+			std::size_t size() const noexcept {return _swapchains.size();}
+			bool empty() const noexcept {return _swapchains.empty();}
+			
+			// Submit the frame's command buffer and queue its image to be presented. Each presenter may only have one frame in a batch.
+			void submit(FramePresenter & frame_presenter, FramePresenter::Frame & frame);
+			
+			// Present every queued image using the present queue of the first presenter, and update the status of each presenter. Returns the first status which isn't OK, if any. The batch is empty afterwards.
+			FramePresenter::Status present();
+			
+			void clear();
+			
+		protected:
+			std::vector<FramePresenter *> _frame_presenters;
+			
+			std::vector<vk::Semaphore> _wait_semaphores;
+			std::vector<vk::SwapchainKHR> _swapchains;
+			std::vector<std::uint32_t> _image_indices;
+			std::vector<vk::Result> _results;
+		};
+	}
+}
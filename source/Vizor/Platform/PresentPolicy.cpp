@@ -0,0 +1,78 @@
+//
+//  PresentPolicy.cpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "PresentPolicy.hpp"
+
+#include <algorithm>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		std::vector<vk::PresentModeKHR> PresentPolicy::preferred_present_modes() const
+		{
+			using M = vk::PresentModeKHR;
+			
+			switch (_mode) {
+				case Mode::LOW_LATENCY:
+					return {M::eImmediate, M::eMailbox, M::eFifo};
+				
+				case Mode::MAX_THROUGHPUT:
+					return {M::eMailbox, M::eFifo};
+				
+				case Mode::POWER_SAVING:
+					return {M::eFifo};
+				
+				case Mode::EXPLICIT:
+					return {_present_mode, M::eFifo};
+			}
+			
+			return {M::eFifo};
+		}
+		
+		vk::PresentModeKHR PresentPolicy::select_present_mode(const std::vector<vk::PresentModeKHR> & present_modes) const
+		{
+			for (auto preferred_mode : preferred_present_modes()) {
+				if (std::find(present_modes.begin(), present_modes.end(), preferred_mode) != present_modes.end()) {
+					return preferred_mode;
+				}
+			}
+			
+			return vk::PresentModeKHR::eFifo;
+		}
+		
+		std::uint32_t PresentPolicy::select_image_count(const vk::SurfaceCapabilitiesKHR & surface_capabilities) const
+		{
+			std::uint32_t image_count = surface_capabilities.minImageCount + 1;
+			
+			switch (_mode) {
+				case Mode::LOW_LATENCY:
+				case Mode::POWER_SAVING:
+					image_count = 2;
+					break;
+				
+				case Mode::MAX_THROUGHPUT:
+					image_count = std::max<std::uint32_t>(image_count, 3);
+					break;
+				
+				case Mode::EXPLICIT:
+					if (_image_count) image_count = _image_count;
+					break;
+			}
+			
+			image_count = std::max(image_count, surface_capabilities.minImageCount);
+			
+			// A maximum of zero means there is no limit:
+			if (surface_capabilities.maxImageCount > 0) {
+				image_count = std::min(image_count, surface_capabilities.maxImageCount);
+			}
+			
+			return image_count;
+		}
+	}
+}
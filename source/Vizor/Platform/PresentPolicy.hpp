@@ -0,0 +1,57 @@
+//
+//  PresentPolicy.hpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include <Vizor/Context.hpp>
+
+#include <vector>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		// Decides which present mode and how many swapchain images to use, falling back to whatever the surface supports.
+		class PresentPolicy
+		{
+		public:
+			enum class Mode {
+				// Minimise the time between rendering and display: immediate or mailbox with as few images as possible.
+				LOW_LATENCY,
+				// Never block on vertical sync where the surface supports mailbox, with an extra image. Otherwise FIFO, as immediate would tear.
+				MAX_THROUGHPUT,
+				// Render no faster than the display refreshes: FIFO with as few images as possible.
+				POWER_SAVING,
+				// Use the given present mode and image count, if supported.
+				EXPLICIT,
+			};
+			
+			PresentPolicy(Mode mode = Mode::MAX_THROUGHPUT) : _mode(mode) {}
+			
+			// An explicit present mode. An image count of zero uses one more than the surface minimum.
+			PresentPolicy(vk::PresentModeKHR present_mode, std::uint32_t image_count = 0) : _mode(Mode::EXPLICIT), _present_mode(present_mode), _image_count(image_count) {}
+			
+			Mode mode() const noexcept {return _mode;}
+			
+			// The present modes this policy would like, in order of preference. FIFO is always last as it is the only mode guaranteed to be supported.
+			std::vector<vk::PresentModeKHR> preferred_present_modes() const;
+			
+			vk::PresentModeKHR select_present_mode(const std::vector<vk::PresentModeKHR> & present_modes) const;
+			std::uint32_t select_image_count(const vk::SurfaceCapabilitiesKHR & surface_capabilities) const;
+			
+			bool operator==(const PresentPolicy & other) const noexcept {return _mode == other._mode && _present_mode == other._present_mode && _image_count == other._image_count;}
+			bool operator!=(const PresentPolicy & other) const noexcept {return !(*this == other);}
+			
+		private:
+			Mode _mode;
+			
+			vk::PresentModeKHR _present_mode = vk::PresentModeKHR::eFifo;
+			std::uint32_t _image_count = 0;
+		};
+	}
+}
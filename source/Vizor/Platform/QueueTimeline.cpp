@@ -0,0 +1,60 @@
+//
+//  QueueTimeline.cpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "QueueTimeline.hpp"
+
+#if defined(VK_VERSION_1_2)
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		QueueTimeline::~QueueTimeline()
+		{
+		}
+		
+		std::uint64_t QueueTimeline::submit(const std::vector<vk::CommandBuffer> & command_buffers, const std::vector<Wait> & waits)
+		{
+			std::vector<vk::Semaphore> wait_semaphores;
+			std::vector<std::uint64_t> wait_values;
+			std::vector<vk::PipelineStageFlags> wait_stages;
+			
+			for (auto & wait : waits) {
+				wait_semaphores.push_back(wait.semaphore);
+				wait_values.push_back(wait.value);
+				wait_stages.push_back(wait.stage);
+			}
+			
+			auto serial = _serial + 1;
+			auto semaphore = _semaphore.get();
+			
+			auto timeline_semaphore_submit_info = vk::TimelineSemaphoreSubmitInfo()
+				.setWaitSemaphoreValueCount(wait_values.size())
+				.setPWaitSemaphoreValues(wait_values.data())
+				.setSignalSemaphoreValueCount(1)
+				.setPSignalSemaphoreValues(&serial);
+			
+			auto submit_info = vk::SubmitInfo()
+				.setPNext(&timeline_semaphore_submit_info)
+				.setWaitSemaphoreCount(wait_semaphores.size())
+				.setPWaitSemaphores(wait_semaphores.data())
+				.setPWaitDstStageMask(wait_stages.data())
+				.setCommandBufferCount(command_buffers.size())
+				.setPCommandBuffers(command_buffers.data())
+				.setSignalSemaphoreCount(1)
+				.setPSignalSemaphores(&semaphore);
+			
+			// This throws on failure, so the serial only advances once the submission succeeded, and a failed submit doesn't leave a serial which will never be reached:
+			_queue.submit(submit_info, nullptr);
+			
+			return _serial = serial;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,51 @@
+//
+//  QueueTimeline.hpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "TimelineSemaphore.hpp"
+
+#include <vector>
+
+#if defined(VK_VERSION_1_2)
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		// Tracks completion of the work submitted to one queue (e.g. a transfer or compute queue) with a timeline semaphore, which is signalled with a new serial by every submission. Requires the timelineSemaphore device feature.
+		class QueueTimeline : public TimelineSemaphore
+		{
+		public:
+			QueueTimeline(const GraphicsContext & graphics_context, vk::Queue queue) : TimelineSemaphore(graphics_context, 0), _queue(queue) {}
+			virtual ~QueueTimeline();
+			
+			vk::Queue queue() const noexcept {return _queue;}
+			
+			// The serial of the most recent submission.
+			std::uint64_t serial() const noexcept {return _serial;}
+			
+			// A semaphore to wait on before executing, e.g. another queue's timeline, or a binary semaphore whose value is ignored.
+			struct Wait
+			{
+				vk::Semaphore semaphore;
+				std::uint64_t value;
+				vk::PipelineStageFlags stage;
+			};
+			
+			// Submit the command buffers and return the serial which the timeline reaches once they complete. Submission must be externally synchronized with anything else submitted to the same queue.
+			std::uint64_t submit(const std::vector<vk::CommandBuffer> & command_buffers, const std::vector<Wait> & waits = {});
+			
+		protected:
+			vk::Queue _queue;
+			std::uint64_t _serial = 0;
+		};
+	}
+}
+
+#endif
@@ -0,0 +1,72 @@
+//
+//  ReadbackRing.cpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "ReadbackRing.hpp"
+
+#include <stdexcept>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		ReadbackRing::ReadbackRing(std::size_t size) : _entries(size)
+		{
+			if (size == 0) {
+				throw std::invalid_argument("Readback ring requires at least one slot!");
+			}
+		}
+		
+		ReadbackRing::~ReadbackRing()
+		{
+		}
+		
+		std::size_t ReadbackRing::reserve()
+		{
+			if (_entries[_next].pending) {
+				_dropped += 1;
+				return NONE;
+			}
+			
+			return _next;
+		}
+		
+		void ReadbackRing::commit(std::size_t index, std::uint64_t serial)
+		{
+			if (index != _next || _entries[index].pending) {
+				throw std::logic_error("Readback slot was not reserved!");
+			}
+			
+			_entries[index] = {true, serial};
+			
+			_next = (_next + 1) % _entries.size();
+			_recorded += 1;
+		}
+		
+		std::size_t ReadbackRing::collect(std::uint64_t completed_serial, const std::function<void(std::size_t index)> & deliver)
+		{
+			std::size_t count = 0;
+			
+			// Slots are recorded in order, so stop at the first one which hasn't completed:
+			while (true) {
+				auto & entry = _entries[_oldest];
+				
+				if (!entry.pending || entry.serial > completed_serial) break;
+				
+				deliver(_oldest);
+				
+				entry.pending = false;
+				_oldest = (_oldest + 1) % _entries.size();
+				
+				_delivered += 1;
+				count += 1;
+			}
+			
+			return count;
+		}
+	}
+}
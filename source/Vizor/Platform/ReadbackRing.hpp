@@ -0,0 +1,62 @@
+//
+//  ReadbackRing.hpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		// The order in which readback buffers are used: recorded into round robin, and delivered oldest first once their frame has completed. If the next buffer is still pending, the frame is dropped.
+		class ReadbackRing
+		{
+		public:
+			static constexpr std::size_t NONE = SIZE_MAX;
+			
+			ReadbackRing(std::size_t size);
+			~ReadbackRing();
+			
+			std::size_t size() const noexcept {return _entries.size();}
+			
+			// The number of frames which were recorded, delivered, and dropped because no buffer was free.
+			std::size_t recorded() const noexcept {return _recorded;}
+			std::size_t delivered() const noexcept {return _delivered;}
+			std::size_t dropped() const noexcept {return _dropped;}
+			
+			// The slot to record the next frame into, or NONE if it is still pending, in which case the frame is dropped.
+			std::size_t reserve();
+			
+			// Mark the slot from reserve() as pending until the given serial has completed.
+			void commit(std::size_t index, std::uint64_t serial);
+			
+			// Deliver every pending slot whose serial has completed, oldest first. Returns the number delivered.
+			std::size_t collect(std::uint64_t completed_serial, const std::function<void(std::size_t index)> & deliver);
+			
+		private:
+			struct Entry
+			{
+				bool pending = false;
+				std::uint64_t serial = 0;
+			};
+			
+			std::vector<Entry> _entries;
+			
+			// The next slot to record into, and the oldest slot which may be pending:
+			std::size_t _next = 0;
+			std::size_t _oldest = 0;
+			
+			std::size_t _recorded = 0;
+			std::size_t _delivered = 0;
+			std::size_t _dropped = 0;
+		};
+	}
+}
@@ -0,0 +1,44 @@
+//
+//  RenderTarget.cpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "RenderTarget.hpp"
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		RenderTarget::~RenderTarget()
+		{
+		}
+		
+		void RenderTarget::notify(const Changes & changes)
+		{
+			for (auto & observer : _observers) {
+				observer(*this, changes);
+			}
+		}
+		
+		bool RenderTarget::supports_image_usage(vk::PhysicalDevice physical_device, std::uint32_t api_version, vk::Format format, vk::ImageUsageFlags image_usage)
+		{
+			auto features = physical_device.getFormatProperties(format).optimalTilingFeatures;
+			
+			if ((image_usage & vk::ImageUsageFlagBits::eColorAttachment) && !(features & vk::FormatFeatureFlagBits::eColorAttachment)) return false;
+			if ((image_usage & vk::ImageUsageFlagBits::eStorage) && !(features & vk::FormatFeatureFlagBits::eStorageImage)) return false;
+			if ((image_usage & vk::ImageUsageFlagBits::eSampled) && !(features & vk::FormatFeatureFlagBits::eSampledImage)) return false;
+			
+#if defined(VK_VERSION_1_1)
+			if (api_version >= VK_API_VERSION_1_1) {
+				if ((image_usage & vk::ImageUsageFlagBits::eTransferSrc) && !(features & vk::FormatFeatureFlagBits::eTransferSrc)) return false;
+				if ((image_usage & vk::ImageUsageFlagBits::eTransferDst) && !(features & vk::FormatFeatureFlagBits::eTransferDst)) return false;
+			}
+#endif
+			
+			return true;
+		}
+	}
+}
@@ -0,0 +1,118 @@
+//
+//  RenderTarget.hpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "SurfaceContext.hpp"
+#include "RetirementQueue.hpp"
+
+#include <functional>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		// A rotating set of images which are acquired, rendered into and then released, one frame at a time. Rendering code which only depends on this interface works the same with a swapchain or offscreen.
+		class RenderTarget : public SurfaceContext
+		{
+		public:
+			struct QueueFamilyIndices
+			{
+				std::uint32_t graphics_queue_family_index;
+				std::uint32_t present_queue_family_index;
+			};
+			
+			RenderTarget(const SurfaceContext & surface_context, QueueFamilyIndices queue_family_indices, vk::Extent2D extent) : SurfaceContext(surface_context), _queue_family_indices(queue_family_indices), _extent(extent) {}
+			virtual ~RenderTarget();
+			
+			RenderTarget(const RenderTarget &) = delete;
+			
+			const vk::Extent2D & extent() const noexcept {return _extent;}
+			const vk::SurfaceFormatKHR & surface_format() const noexcept {return _surface_format;}
+			const QueueFamilyIndices & queue_family_indices() const noexcept {return _queue_family_indices;}
+			
+			struct Buffer {
+				vk::Image image;
+				
+				// Null if the image usage doesn't need a view, e.g. if it is only a transfer destination.
+				vk::UniqueImageView image_view;
+			};
+			
+			const std::vector<Buffer> & buffers() const noexcept {return _buffers;}
+			
+			// Incremented every time the buffers are recreated.
+			std::uint64_t generation() const noexcept {return _generation;}
+			
+			// The swapchain which the buffers belong to, if any.
+			virtual vk::SwapchainKHR swapchain() {return nullptr;}
+			
+			// Old buffers and anything else which must outlive the frames in flight are parked here until those frames have completed.
+			RetirementQueue & retirement_queue() noexcept {return _retirement_queue;}
+			
+			// Recreate the buffers with a new extent, without waiting for the device to become idle. The previous buffers are retired.
+			virtual void resize(vk::Extent2D extent) = 0;
+			
+			enum class Status {
+				OK,
+				// The image can still be presented, but the swapchain will be recreated at the next acquire.
+				SUBOPTIMAL,
+				// No image was acquired or presented. The swapchain will be recreated at the next acquire.
+				OUT_OF_DATE,
+				// The surface is no longer usable and won't recover. It must be recreated, along with the render target.
+				SURFACE_LOST,
+				TIMEOUT,
+				// The surface has a zero extent, so there is nothing to render to. Use wait_for_surface() rather than trying again straight away.
+				SUSPENDED,
+			};
+			
+			// Acquire the next image. The semaphore (and fence, if given) are signalled once the image can be rendered into.
+			virtual Status acquire(vk::Semaphore semaphore, vk::Fence fence, std::uint64_t timeout, std::uint32_t & image_index) = 0;
+			
+			// Release the given image once the semaphore is signalled, e.g. by presenting it. The swapchain is the one the image was acquired from, which may have been retired since.
+			virtual Status present(vk::Queue queue, vk::SwapchainKHR swapchain, vk::Semaphore wait_semaphore, std::uint32_t image_index) = 0;
+			
+			// Block until the target can be rendered into again after acquire() returned SUSPENDED. Returns true if it changed before the timeout (in nanoseconds).
+			virtual bool wait_for_surface(std::uint64_t timeout = UINT64_MAX) {return false;}
+			
+			// What changed when the buffers were (re)created, so that observers only rebuild what depends on them.
+			struct Changes
+			{
+				bool extent = false;
+				bool surface_format = false;
+				bool image_count = false;
+			};
+			
+			typedef std::function<void(RenderTarget & render_target, const Changes & changes)> Observer;
+			
+			// Observers are invoked after the buffers are (re)created, on the thread which caused it. They must remain valid for the lifetime of the target.
+			void observe(Observer observer) {_observers.push_back(std::move(observer));}
+			
+			// The full-target viewport and scissor, for pipelines which use dynamic viewport and scissor state.
+			vk::Viewport viewport() const noexcept {return vk::Viewport(0, 0, _extent.width, _extent.height, 0, 1);}
+			vk::Rect2D scissor() const noexcept {return vk::Rect2D({0, 0}, _extent);}
+			
+		protected:
+			virtual void notify(const Changes & changes);
+			
+			// Whether optimally tiled images of the given format can be used as required by the image usage. Transfer support is only reported from Vulkan 1.1, so it's only checked if the api version is at least that.
+			static bool supports_image_usage(vk::PhysicalDevice physical_device, std::uint32_t api_version, vk::Format format, vk::ImageUsageFlags image_usage);
+			
+			QueueFamilyIndices _queue_family_indices;
+			
+			vk::Extent2D _extent;
+			vk::SurfaceFormatKHR _surface_format;
+			
+			std::vector<Buffer> _buffers;
+			std::uint64_t _generation = 0;
+			
+			std::vector<Observer> _observers;
+			
+			RetirementQueue _retirement_queue;
+		};
+	}
+}
@@ -0,0 +1,100 @@
+//
+//  ResolutionController.cpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "ResolutionController.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		ResolutionController::ResolutionController(std::uint64_t budget, float minimum_scale, float maximum_scale, float step) : _budget(budget), _minimum_scale(minimum_scale), _maximum_scale(maximum_scale), _step(step), _scale(maximum_scale)
+		{
+			if (step <= 0 || minimum_scale <= 0 || minimum_scale > maximum_scale) {
+				throw std::invalid_argument("Invalid resolution scale range!");
+			}
+		}
+		
+		ResolutionController::~ResolutionController()
+		{
+		}
+		
+		void ResolutionController::set_hysteresis(float headroom, std::size_t decrease_frames, std::size_t increase_frames) noexcept
+		{
+			_headroom = headroom;
+			_decrease_frames = decrease_frames;
+			_increase_frames = increase_frames;
+		}
+		
+		float ResolutionController::quantize(float scale) const noexcept
+		{
+			// The epsilon avoids rounding an exact multiple down a whole step:
+			scale = std::floor(scale / _step + 1e-3f) * _step;
+			
+			return std::clamp(scale, _minimum_scale, _maximum_scale);
+		}
+		
+		bool ResolutionController::update(std::uint64_t serial, std::uint64_t frame_time, std::uint64_t current_serial)
+		{
+			// Measured at the previous scale, or already added:
+			if (serial < _scale_serial || (_serial && serial <= _serial)) return false;
+			
+			_serial = serial;
+			
+			if (_measured) {
+				_average += (frame_time - _average) * SMOOTHING;
+			} else {
+				_average = frame_time;
+				_measured = true;
+			}
+			
+			if (_average > _budget) {
+				_over_budget += 1;
+				_under_budget = 0;
+			} else if (_average < _budget * _headroom) {
+				_under_budget += 1;
+				_over_budget = 0;
+			} else {
+				_over_budget = _under_budget = 0;
+			}
+			
+			auto scale = _scale;
+			
+			if (_over_budget >= _decrease_frames) {
+				// GPU time is roughly proportional to the number of pixels, which is the square of the scale:
+				scale = std::min(quantize(_scale * std::sqrt(_budget * _headroom / _average)), _scale - _step);
+			} else if (_under_budget >= _increase_frames) {
+				scale = _scale + _step;
+			}
+			
+			scale = quantize(scale);
+			
+			if (scale == _scale) return false;
+			
+			_scale = scale;
+			
+			// Measurements at the previous scale no longer apply, including those of frames which are still in flight:
+			_scale_serial = current_serial;
+			_measured = false;
+			_over_budget = _under_budget = 0;
+			
+			return true;
+		}
+		
+		vk::Extent2D ResolutionController::extent(vk::Extent2D output) const noexcept
+		{
+			return vk::Extent2D(
+				std::max<std::uint32_t>(1, std::lround(output.width * _scale)),
+				std::max<std::uint32_t>(1, std::lround(output.height * _scale))
+			);
+		}
+	}
+}
@@ -0,0 +1,74 @@
+//
+//  ResolutionController.hpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include <vulkan/vulkan.hpp>
+
+#include <cstdint>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		// Chooses a render scale so that the measured GPU frame time stays within a budget. The scale drops quickly when over budget and only recovers one step at a time after a sustained period of headroom, and frame times between the two thresholds leave it alone, so the scale doesn't oscillate.
+		class ResolutionController
+		{
+		public:
+			// The budget is in nanoseconds, e.g. 16'666'667 for 60Hz. Scales apply to each axis, and are rounded down to a multiple of the step.
+			ResolutionController(std::uint64_t budget, float minimum_scale = 0.5f, float maximum_scale = 1.0f, float step = 0.05f);
+			virtual ~ResolutionController();
+			
+			std::uint64_t budget() const noexcept {return _budget;}
+			void set_budget(std::uint64_t budget) noexcept {_budget = budget;}
+			
+			float scale() const noexcept {return _scale;}
+			float minimum_scale() const noexcept {return _minimum_scale;}
+			float maximum_scale() const noexcept {return _maximum_scale;}
+			
+			// The smoothed frame time which decisions are based on.
+			std::uint64_t average() const noexcept {return static_cast<std::uint64_t>(_average);}
+			
+			// Scale up only after increase_frames consecutive frames below the headroom fraction of the budget, and scale down after decrease_frames consecutive frames over budget.
+			void set_hysteresis(float headroom, std::size_t decrease_frames, std::size_t increase_frames) noexcept;
+			
+			float headroom() const noexcept {return _headroom;}
+			
+			// How much weight each new frame time has in the average.
+			static constexpr double SMOOTHING = 0.2;
+			
+			// Add the GPU time of the completed frame with the given serial. The current serial is the frame being prepared, which is the first to render at a new scale. Frames before it may still be in flight at the old scale, so when the scale changes, their times are ignored, as are times which were already added. Returns true if the scale changed.
+			bool update(std::uint64_t serial, std::uint64_t frame_time, std::uint64_t current_serial);
+			
+			// The extent to render at for the given output extent.
+			vk::Extent2D extent(vk::Extent2D output) const noexcept;
+			
+		protected:
+			float quantize(float scale) const noexcept;
+			
+			std::uint64_t _budget;
+			
+			float _minimum_scale, _maximum_scale, _step;
+			float _scale;
+			
+			float _headroom = 0.85f;
+			std::size_t _decrease_frames = 3;
+			std::size_t _increase_frames = 60;
+			
+			double _average = 0;
+			bool _measured = false;
+			
+			// The most recent frame which was added, and the first frame rendered at the current scale:
+			std::uint64_t _serial = 0;
+			std::uint64_t _scale_serial = 0;
+			
+			std::size_t _over_budget = 0;
+			std::size_t _under_budget = 0;
+		};
+	}
+}
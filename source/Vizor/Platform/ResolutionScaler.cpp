@@ -0,0 +1,128 @@
+//
+//  ResolutionScaler.cpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "ResolutionScaler.hpp"
+
+#include <Logger/Console.hpp>
+
+#include <array>
+#include <stdexcept>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		using namespace Logger;
+		
+		ResolutionScaler::ResolutionScaler(FramePresenter & frame_presenter, ResolutionController & resolution_controller, vk::Format format, vk::ImageUsageFlags image_usage) :
+			GraphicsContext(frame_presenter),
+			_frame_presenter(frame_presenter),
+			_resolution_controller(resolution_controller),
+			_target(frame_presenter, frame_presenter.render_target().present_queue(), frame_presenter.render_target().queue_family_indices().graphics_queue_family_index, resolution_controller.extent(frame_presenter.render_target().extent()), frame_presenter.frames_in_flight(), format, image_usage, frame_presenter.api_version())
+		{
+			// The blit filters linearly, so fail up front rather than at the first frame if either format can't do that:
+			auto source_features = _physical_device.getFormatProperties(format).optimalTilingFeatures;
+			
+			if (!(source_features & vk::FormatFeatureFlagBits::eBlitSrc) || !(source_features & vk::FormatFeatureFlagBits::eSampledImageFilterLinear)) {
+				throw std::runtime_error("Format " + vk::to_string(format) + " does not support linear blits from it!");
+			}
+			
+			auto destination_format = frame_presenter.render_target().surface_format().format;
+			auto destination_features = _physical_device.getFormatProperties(destination_format).optimalTilingFeatures;
+			
+			if (!(destination_features & vk::FormatFeatureFlagBits::eBlitDst)) {
+				throw std::runtime_error("Format " + vk::to_string(destination_format) + " does not support blits to it!");
+			}
+		}
+		
+		ResolutionScaler::~ResolutionScaler()
+		{
+		}
+		
+		const RenderTarget::Buffer & ResolutionScaler::begin(FramePresenter::Frame & frame, std::uint64_t serial, std::uint64_t frame_time)
+		{
+			auto & retirement_queue = _target.retirement_queue();
+			
+			retirement_queue.collect(_frame_presenter.completed_serial());
+			retirement_queue.advance(frame.serial);
+			
+			// This frame is the first which would render at a new scale:
+			if (frame_time && _resolution_controller.update(serial, frame_time, frame.serial)) {
+				Console::info("Resolution scale changed to", _resolution_controller.scale(), "with average frame time", _resolution_controller.average(), "ns");
+			}
+			
+			auto extent = _resolution_controller.extent(_frame_presenter.render_target().extent());
+			
+			if (extent != _target.extent()) {
+				_target.resize(extent);
+			}
+			
+			// The frame's slot has completed, so its image is no longer in use:
+			return _target.buffers()[frame.index];
+		}
+		
+		void ResolutionScaler::blit(FramePresenter::Frame & frame, vk::ImageLayout source_layout, vk::ImageLayout destination_layout)
+		{
+			auto & render_target = _frame_presenter.render_target();
+			
+			blit(frame.command_buffer, _target.buffers()[frame.index].image, _target.extent(), source_layout, render_target.buffers()[frame.image_index].image, render_target.extent(), destination_layout);
+		}
+		
+		void ResolutionScaler::blit(vk::CommandBuffer command_buffer, vk::Image source, vk::Extent2D source_extent, vk::ImageLayout source_layout, vk::Image destination, vk::Extent2D destination_extent, vk::ImageLayout destination_layout)
+		{
+			auto subresource_range = vk::ImageSubresourceRange(vk::ImageAspectFlagBits::eColor, 0, 1, 0, 1);
+			
+			std::array<vk::ImageMemoryBarrier, 2> before = {
+				// Wait for rendering into the source to finish:
+				vk::ImageMemoryBarrier()
+					.setSrcAccessMask(vk::AccessFlagBits::eColorAttachmentWrite)
+					.setDstAccessMask(vk::AccessFlagBits::eTransferRead)
+					.setOldLayout(source_layout)
+					.setNewLayout(vk::ImageLayout::eTransferSrcOptimal)
+					.setSrcQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
+					.setDstQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
+					.setImage(source)
+					.setSubresourceRange(subresource_range),
+				// The whole destination is overwritten, so its previous contents can be discarded:
+				vk::ImageMemoryBarrier()
+					.setSrcAccessMask(vk::AccessFlags())
+					.setDstAccessMask(vk::AccessFlagBits::eTransferWrite)
+					.setOldLayout(vk::ImageLayout::eUndefined)
+					.setNewLayout(vk::ImageLayout::eTransferDstOptimal)
+					.setSrcQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
+					.setDstQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
+					.setImage(destination)
+					.setSubresourceRange(subresource_range),
+			};
+			
+			command_buffer.pipelineBarrier(vk::PipelineStageFlagBits::eColorAttachmentOutput, vk::PipelineStageFlagBits::eTransfer, vk::DependencyFlags(), nullptr, nullptr, before);
+			
+			auto subresource_layers = vk::ImageSubresourceLayers(vk::ImageAspectFlagBits::eColor, 0, 0, 1);
+			
+			auto image_blit = vk::ImageBlit()
+				.setSrcSubresource(subresource_layers)
+				.setSrcOffsets({vk::Offset3D(0, 0, 0), vk::Offset3D(source_extent.width, source_extent.height, 1)})
+				.setDstSubresource(subresource_layers)
+				.setDstOffsets({vk::Offset3D(0, 0, 0), vk::Offset3D(destination_extent.width, destination_extent.height, 1)});
+			
+			command_buffer.blitImage(source, vk::ImageLayout::eTransferSrcOptimal, destination, vk::ImageLayout::eTransferDstOptimal, {image_blit}, vk::Filter::eLinear);
+			
+			auto after = vk::ImageMemoryBarrier()
+				.setSrcAccessMask(vk::AccessFlagBits::eTransferWrite)
+				.setDstAccessMask(vk::AccessFlags())
+				.setOldLayout(vk::ImageLayout::eTransferDstOptimal)
+				.setNewLayout(destination_layout)
+				.setSrcQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
+				.setDstQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
+				.setImage(destination)
+				.setSubresourceRange(subresource_range);
+			
+			command_buffer.pipelineBarrier(vk::PipelineStageFlagBits::eTransfer, vk::PipelineStageFlagBits::eBottomOfPipe, vk::DependencyFlags(), nullptr, nullptr, {after});
+		}
+	}
+}
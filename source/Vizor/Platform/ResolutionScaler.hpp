@@ -0,0 +1,47 @@
+//
+//  ResolutionScaler.hpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "FramePresenter.hpp"
+#include "OffscreenController.hpp"
+#include "ResolutionController.hpp"
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		// Renders each frame into an internal target whose extent follows a resolution controller, and then blits it into the presenter's image. The internal target has one image per frame in flight, and is resized without waiting for the device; observe target() to rebuild framebuffers when that happens.
+		class ResolutionScaler : public GraphicsContext
+		{
+		public:
+			ResolutionScaler(FramePresenter & frame_presenter, ResolutionController & resolution_controller, vk::Format format = vk::Format::eB8G8R8A8Unorm, vk::ImageUsageFlags image_usage = vk::ImageUsageFlagBits::eColorAttachment | vk::ImageUsageFlagBits::eTransferSrc);
+			virtual ~ResolutionScaler();
+			
+			ResolutionScaler(const ResolutionScaler &) = delete;
+			
+			OffscreenController & target() noexcept {return _target;}
+			const vk::Extent2D & extent() const noexcept {return _target.extent();}
+			
+			// Update the controller with the GPU time of the most recently completed frame and its serial (e.g. from FrameProfiler::frame_time()), and resize the internal target if the scale or the output extent changed. Times from frames rendered at a previous scale, or which were already seen, are ignored. Returns the internal image to render this frame into.
+			const RenderTarget::Buffer & begin(FramePresenter::Frame & frame, std::uint64_t serial, std::uint64_t frame_time);
+			
+			// Blit the frame's internal image, which must be in the given layout, into the presenter's image and leave that ready to present. The presenter's images need the eTransferDst image usage.
+			void blit(FramePresenter::Frame & frame, vk::ImageLayout source_layout, vk::ImageLayout destination_layout = vk::ImageLayout::ePresentSrcKHR);
+			
+			// Scale the source image into the whole destination image with linear filtering. The source is left in eTransferSrcOptimal and the destination in the given layout; its previous contents are discarded.
+			static void blit(vk::CommandBuffer command_buffer, vk::Image source, vk::Extent2D source_extent, vk::ImageLayout source_layout, vk::Image destination, vk::Extent2D destination_extent, vk::ImageLayout destination_layout);
+			
+		protected:
+			FramePresenter & _frame_presenter;
+			ResolutionController & _resolution_controller;
+			
+			OffscreenController _target;
+		};
+	}
+}
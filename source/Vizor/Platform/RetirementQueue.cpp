@@ -0,0 +1,36 @@
+//
+//  RetirementQueue.cpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "RetirementQueue.hpp"
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		RetirementQueue::~RetirementQueue()
+		{
+			clear();
+		}
+		
+		void RetirementQueue::collect(std::uint64_t completed_serial)
+		{
+			// Entries are retired in serial order, so we only need to look at the front:
+			while (!_entries.empty() && _entries.front().serial <= completed_serial) {
+				_entries.pop_front();
+			}
+		}
+		
+		void RetirementQueue::clear()
+		{
+			// Destroy the oldest objects first, in the same order as collect():
+			while (!_entries.empty()) {
+				_entries.pop_front();
+			}
+		}
+	}
+}
@@ -0,0 +1,62 @@
+//
+//  RetirementQueue.hpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <type_traits>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		// Defers destruction of device objects until the frames which may still be using them have completed on the GPU.
+		class RetirementQueue
+		{
+		public:
+			RetirementQueue() {}
+			~RetirementQueue();
+			
+			RetirementQueue(const RetirementQueue &) = delete;
+			
+			// The serial of the most recently acquired frame. Objects retired now may be in use by this frame or any before it.
+			std::uint64_t serial() const noexcept {return _serial;}
+			void advance(std::uint64_t serial) noexcept {_serial = serial;}
+			
+			// Take ownership of the given object, and destroy it once the current serial has completed.
+			template <typename ObjectT>
+			void retire(ObjectT && object)
+			{
+				using Object = std::decay_t<ObjectT>;
+				
+				_entries.push_back({_serial, std::make_shared<Object>(std::forward<ObjectT>(object))});
+			}
+			
+			// Destroy every object retired at or before the given serial, which the caller guarantees has completed.
+			void collect(std::uint64_t completed_serial);
+			
+			// Destroy everything immediately, e.g. after the device has become idle.
+			void clear();
+			
+			bool empty() const noexcept {return _entries.empty();}
+			std::size_t size() const noexcept {return _entries.size();}
+			
+		private:
+			struct Entry
+			{
+				std::uint64_t serial;
+				std::shared_ptr<void> object;
+			};
+			
+			std::uint64_t _serial = 0;
+			std::deque<Entry> _entries;
+		};
+	}
+}
@@ -0,0 +1,38 @@
+//
+//  Surface.cpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Surface.hpp"
+
+#include <Logger/Console.hpp>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		using namespace Logger;
+		
+		Surface::~Surface()
+		{
+		}
+		
+		vk::SurfaceKHR Surface::surface()
+		{
+			if (!_surface) {
+				Console::info("setup_surface()");
+				setup_surface();
+				Console::info("setup_surface() ->", _surface.get());
+			}
+			
+			return _surface.get();
+		}
+		
+		void Surface::prepare(Layers & layers, Extensions & extensions) const noexcept
+		{
+		}
+	}
+}
@@ -0,0 +1,34 @@
+//
+//  Surface.hpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include <Vizor/Context.hpp>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		// Something which can be presented to, e.g. a native window or a headless surface.
+		class Surface : public Context
+		{
+		public:
+			Surface(const Context & context) : Context(context) {}
+			virtual ~Surface();
+			
+			vk::SurfaceKHR surface();
+			
+			virtual void prepare(Layers & layers, Extensions & extensions) const noexcept;
+			
+		protected:
+			virtual void setup_surface() = 0;
+			
+			vk::UniqueSurfaceKHR _surface;
+		};
+	}
+}
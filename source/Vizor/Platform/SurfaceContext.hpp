@@ -18,15 +18,19 @@ namespace Vizor
 		class SurfaceContext : public GraphicsContext
 		{
 		public:
-			SurfaceContext(const GraphicsContext & graphics_context, vk::Queue present_queue, vk::SurfaceKHR surface) : GraphicsContext(graphics_context), _present_queue(present_queue), _surface(surface) {}
+			SurfaceContext(const GraphicsContext & graphics_context, vk::Queue present_queue, vk::SurfaceKHR surface, std::uint32_t api_version = VK_API_VERSION_1_0) : GraphicsContext(graphics_context), _present_queue(present_queue), _surface(surface), _api_version(api_version) {}
 			virtual ~SurfaceContext();
 			
 			vk::Queue present_queue() {return _present_queue;}
 			vk::SurfaceKHR surface() {return _surface;}
 			
+			// The API version usable with the device, i.e. the lower of the instance and device versions.
+			std::uint32_t api_version() const noexcept {return _api_version;}
+			
 		protected:
 			vk::Queue _present_queue = nullptr;
 			vk::SurfaceKHR _surface = nullptr;
+			std::uint32_t _api_version = VK_API_VERSION_1_0;
 		};
 	}
 }
@@ -12,6 +12,8 @@
 #include <Streams/Container.hpp>
 #include <Streams/Safe.hpp>
 
+#include <map>
+
 namespace Vizor
 {
 	namespace Platform
@@ -25,12 +27,42 @@ namespace Vizor
 		vk::SurfaceKHR SurfaceDevice::surface()
 		{
 			if (!_surface) {
-				_surface = _window.surface();
+				_surface = _targets.front()->surface();
 			}
 			
 			return _surface;
 		}
 		
+		void SurfaceDevice::add_target(Surface & target)
+		{
+			if (_device) {
+				throw std::logic_error("Targets must be added before the device is created!");
+			}
+			
+			_targets.push_back(&target);
+		}
+		
+		bool SurfaceDevice::can_present(std::uint32_t queue_family_index) const
+		{
+			for (auto target : _targets) {
+				if (!_physical_device.getSurfaceSupportKHR(queue_family_index, target->surface())) {
+					return false;
+				}
+			}
+			
+			return true;
+		}
+		
+		void SurfaceDevice::request_features(const DeviceFeatures & required, const DeviceFeatures & optional)
+		{
+			if (_device) {
+				throw std::logic_error("Features must be requested before the device is created!");
+			}
+			
+			_required_features = _required_features | required;
+			_optional_features = _optional_features | optional;
+		}
+		
 		void SurfaceDevice::prepare(Layers & layers, Extensions & extensions) const noexcept
 		{
 			GraphicsDevice::prepare(layers, extensions);
@@ -39,38 +71,72 @@ namespace Vizor
 				extensions.push_back(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
 			}
 			
-			_window.prepare(layers, extensions);
+			for (auto target : _targets) {
+				target->prepare(layers, extensions);
+			}
+			
 			Console::info("prepare(", Streams::safe(layers), Streams::safe(extensions), ")");
 		}
 		
+		void SurfaceDevice::request_queues(std::vector<float> transfer_queue_priorities, std::vector<float> compute_queue_priorities)
+		{
+			if (_device) {
+				throw std::logic_error("Queues must be requested before the device is created!");
+			}
+			
+			_transfer_queue_priorities = std::move(transfer_queue_priorities);
+			_compute_queue_priorities = std::move(compute_queue_priorities);
+		}
+		
 		void SurfaceDevice::setup_queues()
 		{
 			Console::info("setup_queues()");
-			auto surface = this->surface();
 			
 			auto queue_family_properties = _physical_device.getQueueFamilyProperties();
 			
+			// Prefer a graphics family which can also present to every target, as it avoids sharing images between families:
 			for (std::size_t index = 0; index < queue_family_properties.size(); index += 1) {
 				auto & properties = queue_family_properties[index];
 				
 				if (properties.queueCount == 0) continue;
 				
+				auto can_present = this->can_present(index);
+				
 				if (properties.queueFlags & vk::QueueFlagBits::eGraphics) {
-					_graphics_queue_family_index = index;
+					if (_graphics_queue_family_index == -1) {
+						_graphics_queue_family_index = index;
+					}
+					
+					if (can_present) {
+						_graphics_queue_family_index = _present_queue_family_index = index;
+						break;
+					}
 				}
 				
-				auto can_present = _physical_device.getSurfaceSupportKHR(index, surface);
-				
-				if (can_present) {
+				if (can_present && _present_queue_family_index == -1) {
 					_present_queue_family_index = index;
-					
-					if (_graphics_queue_family_index == _present_queue_family_index) {
-						break;
+				}
+			}
+			
+			// Dedicated families run independently of rendering, e.g. DMA engines for transfer:
+			for (std::size_t index = 0; index < queue_family_properties.size(); index += 1) {
+				auto & properties = queue_family_properties[index];
+				
+				if (properties.queueCount == 0) continue;
+				if (properties.queueFlags & vk::QueueFlagBits::eGraphics) continue;
+				
+				if (properties.queueFlags & vk::QueueFlagBits::eCompute) {
+					if (_compute_queue_family_index == -1) {
+						_compute_queue_family_index = index;
+					}
+				} else if (properties.queueFlags & vk::QueueFlagBits::eTransfer) {
+					if (_transfer_queue_family_index == -1) {
+						_transfer_queue_family_index = index;
 					}
 				}
 			}
 			
-			Console::info("setup_queues() ->", _graphics_queue_family_index, _present_queue_family_index);
+			Console::info("setup_queues() ->", _graphics_queue_family_index, _present_queue_family_index, _transfer_queue_family_index, _compute_queue_family_index);
 			
 			if (_graphics_queue_family_index == -1) {
 				throw std::runtime_error("Could not find graphics queue!");
@@ -79,25 +145,50 @@ namespace Vizor
 			if (_present_queue_family_index == -1) {
 				throw std::runtime_error("Could not find present queue!");
 			}
+			
+			// Without dedicated families, transfer and compute work share the graphics queue:
+			if (_transfer_queue_family_index == -1 || _transfer_queue_priorities.empty()) {
+				_transfer_queue_family_index = _graphics_queue_family_index;
+			}
+			
+			if (_compute_queue_family_index == -1 || _compute_queue_priorities.empty()) {
+				_compute_queue_family_index = _graphics_queue_family_index;
+			}
 		}
 		
 		void SurfaceDevice::setup_device(Layers & layers, Extensions & extensions)
 		{
 			Console::info("setup_device(layers, extensions)");
-			float queue_priority = 1.0f;
 			
 			setup_queues();
 			
-			std::size_t queue_count = (_graphics_queue_family_index == _present_queue_family_index) ? 1 : 2;
-			vk::DeviceQueueCreateInfo queue_create_infos[queue_count];
+			auto queue_family_properties = _physical_device.getQueueFamilyProperties();
 			
-			for (std::size_t index = 0; index < queue_count; index += 1) {
-				auto queue_family_index = index == 0 ? _graphics_queue_family_index : _present_queue_family_index;
-				
-				queue_create_infos[index]
-					.setQueueCount(1)
-					.setQueueFamilyIndex(queue_family_index)
-					.setPQueuePriorities(&queue_priority);
+			// The priorities of the queues to create in each family:
+			std::map<std::uint32_t, std::vector<float>> queue_priorities;
+			
+			queue_priorities[_graphics_queue_family_index] = {1.0f};
+			queue_priorities[_present_queue_family_index] = {1.0f};
+			
+			if (_transfer_queue_family_index != _graphics_queue_family_index) {
+				auto & priorities = queue_priorities[_transfer_queue_family_index] = _transfer_queue_priorities;
+				priorities.resize(std::min<std::size_t>(priorities.size(), queue_family_properties[_transfer_queue_family_index].queueCount));
+			}
+			
+			if (_compute_queue_family_index != _graphics_queue_family_index) {
+				auto & priorities = queue_priorities[_compute_queue_family_index] = _compute_queue_priorities;
+				priorities.resize(std::min<std::size_t>(priorities.size(), queue_family_properties[_compute_queue_family_index].queueCount));
+			}
+			
+			std::vector<vk::DeviceQueueCreateInfo> queue_create_infos;
+			
+			for (auto & entry : queue_priorities) {
+				queue_create_infos.push_back(
+					vk::DeviceQueueCreateInfo()
+						.setQueueCount(entry.second.size())
+						.setQueueFamilyIndex(entry.first)
+						.setPQueuePriorities(entry.second.data())
+				);
 			}
 			
 			auto device_create_info = vk::DeviceCreateInfo()
@@ -105,17 +196,53 @@ namespace Vizor
 				.setPpEnabledLayerNames(layers.data())
 				.setEnabledExtensionCount(extensions.size())
 				.setPpEnabledExtensionNames(extensions.data())
-				.setPQueueCreateInfos(queue_create_infos)
-				.setQueueCreateInfoCount(queue_count);
+				.setPQueueCreateInfos(queue_create_infos.data())
+				.setQueueCreateInfoCount(queue_create_infos.size());
 			
-			// Enable all features by default:
-			auto features = _physical_device.getFeatures();
-			device_create_info.setPEnabledFeatures(&features);
+			auto api_version = this->api_version();
+			auto supported_features = DeviceFeatures::supported_by(_physical_device, api_version);
+			auto missing_features = _required_features.missing_from(supported_features);
+			
+			if (!missing_features.empty()) {
+				std::string message = "Device does not support required features:";
+				
+				for (auto & name : missing_features) {
+					message += " " + name;
+				}
+				
+				throw std::runtime_error(message);
+			}
+			
+			// Only enable what was asked for, as some features (e.g. robustBufferAccess) have a cost even if they are never used:
+			_enabled_features = _required_features | (_optional_features & supported_features);
+			
+			auto features = _enabled_features.chain(api_version);
+			
+			if (api_version >= VK_API_VERSION_1_1) {
+				device_create_info.setPNext(&features);
+			} else {
+				device_create_info.setPEnabledFeatures(&features.features);
+			}
 			
 			GraphicsDevice::setup_device(device_create_info);
 			
 			_graphics_queue = _device->getQueue(_graphics_queue_family_index, 0);
 			_present_queue = _device->getQueue(_present_queue_family_index, 0);
+			
+			_transfer_queues = get_queues(_transfer_queue_family_index, queue_priorities[_transfer_queue_family_index].size());
+			_compute_queues = get_queues(_compute_queue_family_index, queue_priorities[_compute_queue_family_index].size());
+		}
+		
+		std::vector<vk::Queue> SurfaceDevice::get_queues(std::uint32_t queue_family_index, std::size_t count) const
+		{
+			std::vector<vk::Queue> queues;
+			queues.reserve(count);
+			
+			for (std::size_t index = 0; index < count; index += 1) {
+				queues.push_back(_device->getQueue(queue_family_index, index));
+			}
+			
+			return queues;
 		}
 	}
 }
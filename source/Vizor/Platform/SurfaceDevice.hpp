@@ -10,6 +10,7 @@
 #pragma once
 
 #include "SurfaceContext.hpp"
+#include "DeviceFeatures.hpp"
 #include <Vizor/GraphicsDevice.hpp>
 
 namespace Vizor
@@ -19,17 +20,60 @@ namespace Vizor
 		class SurfaceDevice : public GraphicsDevice
 		{
 		public:
-			SurfaceDevice(const PhysicalContext & physical_context, Window & window, bool enable_swapchain = true) : GraphicsDevice(physical_context), _window(window), _enable_swapchain(enable_swapchain) {}
+			SurfaceDevice(const PhysicalContext & physical_context, Surface & target, bool enable_swapchain = true) : GraphicsDevice(physical_context), _targets{&target}, _enable_swapchain(enable_swapchain) {}
 			virtual ~SurfaceDevice();
 			
 			SurfaceDevice(const SurfaceDevice &) = delete;
 			
+			// The surface of the primary target.
 			vk::SurfaceKHR surface();
 			
+			// Add another surface to present to, before the device is created. The present queue family is chosen so that it can present to every target.
+			void add_target(Surface & target);
+			
+			const std::vector<Surface *> & targets() const noexcept {return _targets;}
+			
+			vk::Queue graphics_queue() const noexcept {return _graphics_queue;}
+			
 			std::uint32_t present_queue_family_index() const noexcept {return _present_queue_family_index;}
 			vk::Queue present_queue() const noexcept {return _present_queue;}
 			
-			SurfaceContext context() {return SurfaceContext(GraphicsDevice::context(), present_queue(), surface());}
+			SurfaceContext context() {return SurfaceContext(GraphicsDevice::context(), present_queue(), surface(), api_version());}
+			
+			// The context for presenting to one of the targets.
+			SurfaceContext context(Surface & target) {return SurfaceContext(GraphicsDevice::context(), present_queue(), target.surface(), api_version());}
+			
+			// Request queues from dedicated transfer and compute families, before the device is created. One queue is created per priority, up to the number the family supports. If there is no dedicated family, or no queues are requested, the graphics queue is used instead.
+			void request_queues(std::vector<float> transfer_queue_priorities, std::vector<float> compute_queue_priorities);
+			
+			// Queue submission must be externally synchronized. If the transfer or compute queues aren't dedicated, they are the same vk::Queue as the graphics (or present) queue, so submitting to them from another thread must be serialized with every other submission to that queue.
+			
+			std::uint32_t transfer_queue_family_index() const noexcept {return _transfer_queue_family_index;}
+			const std::vector<vk::Queue> & transfer_queues() const noexcept {return _transfer_queues;}
+			vk::Queue transfer_queue(std::size_t index = 0) const {return _transfer_queues.at(index);}
+			
+			// Whether the transfer queues are distinct from the graphics and present queues.
+			bool transfer_queues_dedicated() const noexcept {return is_dedicated(_transfer_queue_family_index);}
+			
+			std::uint32_t compute_queue_family_index() const noexcept {return _compute_queue_family_index;}
+			const std::vector<vk::Queue> & compute_queues() const noexcept {return _compute_queues;}
+			vk::Queue compute_queue(std::size_t index = 0) const {return _compute_queues.at(index);}
+			
+			// Whether the compute queues are distinct from the graphics and present queues.
+			bool compute_queues_dedicated() const noexcept {return is_dedicated(_compute_queue_family_index);}
+			
+			// Request device features, before the device is created. Missing required features are an error, while missing optional features are simply not enabled. Nothing else is enabled.
+			void request_features(const DeviceFeatures & required, const DeviceFeatures & optional = DeviceFeatures());
+			
+			// The features which were actually enabled when the device was created.
+			const DeviceFeatures & enabled_features() const noexcept {return _enabled_features;}
+			
+			// The API version the instance was created with, before the device is created. Features and structures beyond it are never used, even if the device supports them.
+			void set_instance_api_version(std::uint32_t instance_api_version) noexcept {_instance_api_version = instance_api_version;}
+			std::uint32_t instance_api_version() const noexcept {return _instance_api_version;}
+			
+			// The API version device functionality may use, the lower of the instance and device versions.
+			std::uint32_t api_version() const {return DeviceFeatures::effective_api_version(_physical_device, _instance_api_version);}
 		
 		protected:
 			virtual void prepare(Layers & layers, Extensions & extensions) const noexcept override;
@@ -38,12 +82,34 @@ namespace Vizor
 			
 			virtual void setup_device(Layers & layers, Extensions & extensions) override;
 			
-			Window & _window;
+			std::vector<vk::Queue> get_queues(std::uint32_t queue_family_index, std::size_t count) const;
+			
+			// Queues are only created once per family, so a family shared with the graphics or present queue shares its first queue too.
+			bool is_dedicated(std::uint32_t queue_family_index) const noexcept {return queue_family_index != _graphics_queue_family_index && queue_family_index != _present_queue_family_index;}
+			
+			// Whether the given queue family can present to every target.
+			bool can_present(std::uint32_t queue_family_index) const;
+			
+			std::vector<Surface *> _targets;
 			bool _enable_swapchain;
 			
+			DeviceFeatures _required_features;
+			DeviceFeatures _optional_features;
+			DeviceFeatures _enabled_features;
+			
+			std::uint32_t _instance_api_version = VK_API_VERSION_1_0;
+			
 			std::uint32_t _present_queue_family_index = -1;
 			vk::Queue _present_queue = nullptr;
 			
+			std::vector<float> _transfer_queue_priorities = {1.0f};
+			std::uint32_t _transfer_queue_family_index = -1;
+			std::vector<vk::Queue> _transfer_queues;
+			
+			std::vector<float> _compute_queue_priorities = {1.0f};
+			std::uint32_t _compute_queue_family_index = -1;
+			std::vector<vk::Queue> _compute_queues;
+			
 			vk::SurfaceKHR _surface;
 		};
 	}
@@ -0,0 +1,64 @@
+//
+//  SurfaceSignal.cpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "SurfaceSignal.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		void SurfaceSignal::notify(vk::Extent2D extent)
+		{
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				
+				_extent = extent;
+				_pending = true;
+			}
+			
+			_condition.notify_all();
+		}
+		
+		bool SurfaceSignal::take(vk::Extent2D & extent)
+		{
+			if (!_pending) return false;
+			
+			std::lock_guard<std::mutex> lock(_mutex);
+			
+			extent = _extent;
+			_pending = false;
+			
+			return true;
+		}
+		
+		bool SurfaceSignal::wait(std::uint64_t timeout)
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			
+			auto predicate = [&]{return _pending.load();};
+			
+			if (!_events) {
+				timeout = std::min(timeout, POLL_INTERVAL);
+			}
+			
+			// An infinite timeout would overflow the clock:
+			if (timeout == UINT64_MAX) {
+				_condition.wait(lock, predicate);
+				
+				return true;
+			}
+			
+			auto duration = std::chrono::nanoseconds(std::min<std::uint64_t>(timeout, INT64_MAX / 2));
+			
+			return _condition.wait_for(lock, duration, predicate);
+		}
+	}
+}
@@ -0,0 +1,57 @@
+//
+//  SurfaceSignal.hpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include <Vizor/Context.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		// Hands surface changes (e.g. from a window event handler) over to the thread which acquires images, which can block on it while the surface is suspended.
+		class SurfaceSignal
+		{
+		public:
+			// Platforms which don't report every change are checked at this interval instead.
+			static constexpr std::uint64_t POLL_INTERVAL = 250'000'000;
+			
+			SurfaceSignal() {}
+			
+			SurfaceSignal(const SurfaceSignal &) = delete;
+			
+			// Whether the platform reports every change, e.g. when a minimised window is restored. If not, wait() only blocks for up to POLL_INTERVAL. Must be set before waiting.
+			bool events() const noexcept {return _events;}
+			void set_events(bool events) noexcept {_events = events;}
+			
+			// Record the new extent of the surface and wake up any waiting thread. Safe to call from any thread.
+			void notify(vk::Extent2D extent);
+			
+			bool pending() const noexcept {return _pending;}
+			
+			// Take the extent from the most recent notify(), if it hasn't been taken already. Returns false if nothing changed.
+			bool take(vk::Extent2D & extent);
+			
+			// Block until notify() is called or the timeout (in nanoseconds) expires. Returns true if the surface changed.
+			bool wait(std::uint64_t timeout = UINT64_MAX);
+			
+		private:
+			bool _events = false;
+			
+			std::mutex _mutex;
+			std::condition_variable _condition;
+			
+			std::atomic<bool> _pending{false};
+			vk::Extent2D _extent;
+		};
+	}
+}
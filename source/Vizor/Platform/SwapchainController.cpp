@@ -10,6 +10,9 @@
 
 #include <Logger/Console.hpp>
 
+#include <algorithm>
+#include <stdexcept>
+
 namespace Vizor
 {
 	namespace Platform
@@ -37,35 +40,160 @@ namespace Vizor
 			setup_swapchain();
 		}
 		
+		void SwapchainController::set_present_policy(const PresentPolicy & present_policy)
+		{
+			if (present_policy != _present_policy) {
+				_present_policy = present_policy;
+				_present_policy_changed = true;
+				
+				invalidate();
+			}
+		}
+		
+		void SwapchainController::set_image_usage(vk::ImageUsageFlags image_usage)
+		{
+			if (image_usage == _image_usage) return;
+			
+			// Validate up front, so that an unsupported usage fails here rather than at the next acquire, and the current swapchain remains usable:
+			auto capabilities = _physical_device.getSurfaceCapabilitiesKHR(_surface);
+			
+			if ((capabilities.supportedUsageFlags & image_usage) != image_usage) {
+				throw std::runtime_error("Surface does not support image usage " + vk::to_string(image_usage & ~capabilities.supportedUsageFlags) + "!");
+			}
+			
+			auto previous_image_usage = _image_usage;
+			_image_usage = image_usage;
+			
+			try {
+				select_surface_format(_physical_device.getSurfaceFormatsKHR(_surface));
+			} catch (...) {
+				_image_usage = previous_image_usage;
+				throw;
+			}
+			
+			_image_usage_changed = true;
+			
+			invalidate();
+		}
+		
+		SwapchainController::Status SwapchainController::acquire(vk::Semaphore semaphore, vk::Fence fence, std::uint64_t timeout, std::uint32_t & image_index)
+		{
+			if (_surface_signal.take(_extent)) {
+				_invalidated = true;
+			}
+			
+			if (!_swapchain && !_suspended) {
+				this->swapchain();
+			} else if (_invalidated) {
+				setup_swapchain();
+			}
+			
+			// There is nothing to render to until the surface has a non-zero extent again:
+			if (_suspended) {
+				return Status::SUSPENDED;
+			}
+			
+			auto status = status_for(
+				_device.acquireNextImageKHR(_swapchain.get(), timeout, semaphore, fence, &image_index)
+			);
+			
+			// The semaphore and fence are not signalled when out of date, so we can retry with the same ones:
+			if (status == Status::OUT_OF_DATE) {
+				setup_swapchain();
+				
+				if (_suspended) {
+					return Status::SUSPENDED;
+				}
+				
+				status = status_for(
+					_device.acquireNextImageKHR(_swapchain.get(), timeout, semaphore, fence, &image_index)
+				);
+			}
+			
+			return status;
+		}
+		
+		SwapchainController::Status SwapchainController::present(vk::Queue queue, vk::SwapchainKHR swapchain, vk::Semaphore wait_semaphore, std::uint32_t image_index)
+		{
+			auto present_info = vk::PresentInfoKHR()
+				.setWaitSemaphoreCount(1)
+				.setPWaitSemaphores(&wait_semaphore)
+				.setSwapchainCount(1)
+				.setPSwapchains(&swapchain)
+				.setPImageIndices(&image_index);
+			
+			return status_for(
+				queue.presentKHR(&present_info)
+			);
+		}
+		
+		SwapchainController::Status SwapchainController::status_for(vk::Result result)
+		{
+			switch (result) {
+				case vk::Result::eSuccess:
+					return Status::OK;
+				
+				case vk::Result::eSuboptimalKHR:
+					_invalidated = true;
+					return Status::SUBOPTIMAL;
+				
+				case vk::Result::eErrorOutOfDateKHR:
+					_invalidated = true;
+					return Status::OUT_OF_DATE;
+				
+				case vk::Result::eErrorSurfaceLostKHR:
+					return Status::SURFACE_LOST;
+				
+				case vk::Result::eTimeout:
+				case vk::Result::eNotReady:
+					return Status::TIMEOUT;
+				
+				default:
+					throw vk::SystemError(vk::make_error_code(result), "SwapchainController");
+			}
+		}
+		
 		vk::SurfaceFormatKHR SwapchainController::select_surface_format(const std::vector<vk::SurfaceFormatKHR> & surface_formats)
 		{
+			// The surface has no preferred format, but the one we choose must still support the usage:
 			if (surface_formats.size() == 1 && surface_formats[0].format == vk::Format::eUndefined) {
+				if (!supports_image_usage(vk::Format::eB8G8R8A8Unorm)) {
+					throw std::runtime_error("Format " + vk::to_string(vk::Format::eB8G8R8A8Unorm) + " does not support image usage " + vk::to_string(_image_usage) + "!");
+				}
+				
 				return {vk::Format::eB8G8R8A8Unorm, vk::ColorSpaceKHR::eSrgbNonlinear};
 			}
 			
+			// Not every format supports every usage, e.g. sRGB formats often can't be used as storage images:
+			std::vector<vk::SurfaceFormatKHR> candidates;
+			
 			for (const auto & surface_format : surface_formats) {
+				if (supports_image_usage(surface_format.format)) {
+					candidates.push_back(surface_format);
+				}
+			}
+			
+			if (candidates.empty()) {
+				throw std::runtime_error("No surface format supports image usage " + vk::to_string(_image_usage) + "!");
+			}
+			
+			for (const auto & surface_format : candidates) {
 				if (surface_format.format == vk::Format::eB8G8R8A8Unorm && surface_format.colorSpace == vk::ColorSpaceKHR::eSrgbNonlinear) {
 					return surface_format;
 				}
 			}
 			
-			return surface_formats[0];
+			return candidates[0];
+		}
+		
+		bool SwapchainController::supports_image_usage(vk::Format format) const
+		{
+			return RenderTarget::supports_image_usage(_physical_device, _api_version, format, _image_usage);
 		}
 		
 		vk::PresentModeKHR SwapchainController::select_present_mode(const std::vector<vk::PresentModeKHR> & present_modes)
 		{
-			vk::PresentModeKHR best_mode = vk::PresentModeKHR::eFifo;
-			
-			for (const auto & present_mode : present_modes) {
-				if (present_mode == vk::PresentModeKHR::eMailbox) {
-					return present_mode;
-				}
-				// else if (present_mode == vk::PresentModeKHR::eImmediate) {
-				// 	best_mode = present_mode;
-				// }
-			}
-			
-			return best_mode;
+			return _present_policy.select_present_mode(present_modes);
 		}
 		
 		vk::Extent2D SwapchainController::select_extent(const vk::SurfaceCapabilitiesKHR & surface_capabilities)
@@ -105,16 +233,43 @@ namespace Vizor
 		
 		void SwapchainController::setup_swapchain()
 		{
+			if (_present_policy_changed) {
+				setup_present_mode();
+				_present_policy_changed = false;
+			}
+			
+			if (_image_usage_changed) {
+				setup_surface_format();
+				_image_usage_changed = false;
+			}
+			
 			auto capabilities = _physical_device.getSurfaceCapabilitiesKHR(_surface);
 			
+			if ((capabilities.supportedUsageFlags & _image_usage) != _image_usage) {
+				throw std::runtime_error("Surface does not support image usage " + vk::to_string(_image_usage & ~capabilities.supportedUsageFlags) + "!");
+			}
+			
 			auto extent = select_extent(capabilities);
 			
-			std::size_t image_count = capabilities.minImageCount + 1;
+			// A minimised window has a zero extent, and a swapchain can't be created until it is restored. Stay invalidated so that the next acquire checks again:
+			if (extent.width == 0 || extent.height == 0) {
+				if (!_suspended) {
+					Console::info("Suspending swapchain while the surface has a zero extent.");
+				}
+				
+				_suspended = true;
+				_invalidated = true;
+				
+				return;
+			}
 			
-			if (capabilities.maxImageCount > 0 && image_count > capabilities.maxImageCount) {
-				image_count = capabilities.maxImageCount;
+			if (_suspended) {
+				Console::info("Resuming swapchain with extent", extent.width, "x", extent.height);
+				_suspended = false;
 			}
 			
+			std::size_t image_count = _present_policy.select_image_count(capabilities);
+			
 			Console::info("Setting up swapchain with", image_count, "images...");
 			
 			auto swapchain_create_info = vk::SwapchainCreateInfoKHR()
@@ -124,10 +279,17 @@ namespace Vizor
 				.setImageColorSpace(_surface_format.colorSpace)
 				.setImageExtent(extent)
 				.setImageArrayLayers(1)
-				.setImageUsage(vk::ImageUsageFlagBits::eColorAttachment);
+				.setImageUsage(_image_usage);
+			
+			// Hand the old swapchain to the driver so that it can reuse its resources, and so that presentation continues uninterrupted:
+			auto old_swapchain = std::move(_swapchain);
+			
+			Changes changes;
+			changes.extent = !old_swapchain || extent != _swapchain_extent;
+			changes.surface_format = !old_swapchain || _surface_format != _swapchain_surface_format;
 			
-			if (_swapchain) {
-				swapchain_create_info.setOldSwapchain(_swapchain.release());
+			if (old_swapchain) {
+				swapchain_create_info.setOldSwapchain(old_swapchain.get());
 			}
 			
 			uint32_t queue_family_indices[] = {
@@ -149,16 +311,26 @@ namespace Vizor
 				.setPreTransform(capabilities.currentTransform)
 				.setCompositeAlpha(vk::CompositeAlphaFlagBitsKHR::eOpaque)
 				.setPresentMode(_present_mode)
-				.setClipped(true)
-				.setOldSwapchain(nullptr);
+				.setClipped(true);
 			
 			setup_swapchain(swapchain_create_info);
+			_invalidated = false;
 			
-			setup_image_buffers(
-				_device.getSwapchainImagesKHR(_swapchain.get())
-			);
+			auto images = _device.getSwapchainImagesKHR(_swapchain.get());
+			changes.image_count = !old_swapchain || images.size() != _buffers.size();
 			
-			_extent = extent;
+			// In flight frames may still be using the old images, so defer destruction until they have completed:
+			if (old_swapchain) {
+				_retirement_queue.retire(RetiredSwapchain{std::move(old_swapchain), std::move(_buffers)});
+			}
+			
+			setup_image_buffers(images);
+			_generation += 1;
+			
+			_extent = _swapchain_extent = extent;
+			_swapchain_surface_format = _surface_format;
+			
+			notify(changes);
 		}
 		
 		void SwapchainController::setup_swapchain(vk::SwapchainCreateInfoKHR & swapchain_create_info)
@@ -178,6 +350,17 @@ namespace Vizor
 			_buffers.resize(0);
 			_buffers.reserve(images.size());
 			
+			// Views are only needed to use the images as attachments or from shaders:
+			auto view_usage = vk::ImageUsageFlagBits::eColorAttachment | vk::ImageUsageFlagBits::eStorage | vk::ImageUsageFlagBits::eSampled | vk::ImageUsageFlagBits::eInputAttachment;
+			
+			if (!(_image_usage & view_usage)) {
+				for (auto & image : images) {
+					_buffers.push_back({image, vk::UniqueImageView()});
+				}
+				
+				return;
+			}
+			
 			for (auto & image : images) {
 				auto image_view_create_info = vk::ImageViewCreateInfo()
 					.setImage(image)
@@ -8,44 +8,71 @@
 
 #pragma once
 
-#include "SurfaceContext.hpp"
+#include "RenderTarget.hpp"
+#include "PresentPolicy.hpp"
+#include "SurfaceSignal.hpp"
 #include "Window.hpp"
 
 namespace Vizor
 {
 	namespace Platform
 	{
-		class SwapchainController : public SurfaceContext
+		class SwapchainController : public RenderTarget
 		{
 		public:
-			struct QueueFamilyIndices
-			{
-				std::uint32_t graphics_queue_family_index;
-				std::uint32_t present_queue_family_index;
-			};
-			
-			SwapchainController(const SurfaceContext & surface_context, QueueFamilyIndices queue_family_indices, vk::Extent2D extent) : SurfaceContext(surface_context), _queue_family_indices(queue_family_indices), _extent(extent) {}
+			SwapchainController(const SurfaceContext & surface_context, QueueFamilyIndices queue_family_indices, vk::Extent2D extent, PresentPolicy present_policy = PresentPolicy(), vk::ImageUsageFlags image_usage = vk::ImageUsageFlagBits::eColorAttachment) : RenderTarget(surface_context, queue_family_indices, extent), _present_policy(present_policy), _image_usage(image_usage) {}
 			virtual ~SwapchainController();
 			
-			const vk::Extent2D & extent() const noexcept {return _extent;}
-			const vk::SurfaceFormatKHR & surface_format() const noexcept {return _surface_format;}
+			const PresentPolicy & present_policy() const noexcept {return _present_policy;}
+			vk::PresentModeKHR present_mode() const noexcept {return _present_mode;}
 			
-			vk::SwapchainKHR swapchain();
+			// How the swapchain images will be used, e.g. eStorage to write them from a compute shader or eTransferDst to blit into them. The surface must support every requested usage, and the surface format is chosen so that it does too.
+			vk::ImageUsageFlags image_usage() const noexcept {return _image_usage;}
 			
-			struct Buffer {
-				vk::Image image;
-				vk::UniqueImageView image_view;
-			};
+			// Change the image usage at runtime. The swapchain is recreated at the next acquire. Throws if the surface or none of its formats support the usage, in which case the current usage is kept. Must be called from the thread which acquires images.
+			void set_image_usage(vk::ImageUsageFlags image_usage);
+			
+			// Change the present policy at runtime. The swapchain is recreated (handing over the old one) at the next acquire. Must be called from the thread which acquires images.
+			void set_present_policy(const PresentPolicy & present_policy);
+			
+			virtual vk::SwapchainKHR swapchain() override;
+			
+			// Recreate the swapchain without waiting for the device to become idle. The previous swapchain is retired.
+			virtual void resize(vk::Extent2D extent) override;
+			
+			// Recreate the swapchain at the start of the next acquire().
+			void invalidate() noexcept {_invalidated = true;}
+			bool invalidated() const noexcept {return _invalidated;}
+			
+			// Whether the surface currently has a zero extent (e.g. the window is minimised), in which case no swapchain can be created and acquire() returns SUSPENDED.
+			bool suspended() const noexcept {return _suspended;}
+			
+			// Notify the controller that the surface was resized, restored or exposed. The swapchain is recreated with the given extent at the next acquire(). Safe to call from any thread, e.g. a window event handler, and wakes up wait_for_surface().
+			void surface_changed(vk::Extent2D extent) {_surface_signal.notify(extent);}
 			
-			const std::vector<Buffer> & buffers() const noexcept {return _buffers;}
+			// Whether surface_changed() is called for every change, e.g. from the window's resize handler. Otherwise, the surface is polled while suspended.
+			void set_surface_events(bool surface_events) noexcept {_surface_signal.set_events(surface_events);}
 			
-			virtual void resize(vk::Extent2D extent);
+			// Block until surface_changed() is called or the timeout (in nanoseconds) expires. Returns true if the surface changed. Without surface events, the wait is limited to SurfaceSignal::POLL_INTERVAL.
+			virtual bool wait_for_surface(std::uint64_t timeout = UINT64_MAX) override {return _surface_signal.wait(timeout);}
+			
+			// Acquire the next image without using exceptions for expected results. A swapchain which is out of date is recreated and the acquire is retried once. Unexpected errors (e.g. device lost) still throw.
+			virtual Status acquire(vk::Semaphore semaphore, vk::Fence fence, std::uint64_t timeout, std::uint32_t & image_index) override;
+			
+			// Present the given image, waiting on the given semaphore.
+			virtual Status present(vk::Queue queue, vk::SwapchainKHR swapchain, vk::Semaphore wait_semaphore, std::uint32_t image_index) override;
+			
+			// Map the result of a swapchain operation to a status, invalidating the swapchain if required.
+			Status status_for(vk::Result result);
 			
 		protected:
 			virtual vk::Extent2D select_extent(const vk::SurfaceCapabilitiesKHR & surface_capabilities);
 			virtual vk::SurfaceFormatKHR select_surface_format(const std::vector<vk::SurfaceFormatKHR> & surface_formats);
 			virtual vk::PresentModeKHR select_present_mode(const std::vector<vk::PresentModeKHR> & present_modes);
 			
+			// Whether images of the given format can be used as required by the image usage.
+			bool supports_image_usage(vk::Format format) const;
+			
 			virtual void setup_surface_format();
 			virtual void setup_present_mode();
 			
@@ -55,15 +82,27 @@ namespace Vizor
 			virtual void setup_image_buffers(const std::vector<vk::Image> & images);
 			
 		private:
-			QueueFamilyIndices _queue_family_indices;
-			
-			vk::Extent2D _extent;
-			vk::SurfaceFormatKHR _surface_format;
+			PresentPolicy _present_policy;
+			bool _present_policy_changed = false;
 			vk::PresentModeKHR _present_mode = vk::PresentModeKHR::eFifo;
 			
+			vk::ImageUsageFlags _image_usage;
+			bool _image_usage_changed = false;
+			
 			vk::UniqueSwapchainKHR _swapchain;
+			bool _invalidated = false;
+			bool _suspended = false;
+			
+			SurfaceSignal _surface_signal;
+			
+			vk::Extent2D _swapchain_extent;
+			vk::SurfaceFormatKHR _swapchain_surface_format;
 			
-			std::vector<Buffer> _buffers;
+			struct RetiredSwapchain
+			{
+				vk::UniqueSwapchainKHR swapchain;
+				std::vector<Buffer> buffers;
+			};
 		};
 	}
 }
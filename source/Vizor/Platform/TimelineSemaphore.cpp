@@ -0,0 +1,61 @@
+//
+//  TimelineSemaphore.cpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "TimelineSemaphore.hpp"
+
+#if defined(VK_VERSION_1_2)
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		TimelineSemaphore::TimelineSemaphore(const GraphicsContext & graphics_context, std::uint64_t initial_value) : GraphicsContext(graphics_context)
+		{
+			auto semaphore_type_create_info = vk::SemaphoreTypeCreateInfo()
+				.setSemaphoreType(vk::SemaphoreType::eTimeline)
+				.setInitialValue(initial_value);
+			
+			auto semaphore_create_info = vk::SemaphoreCreateInfo()
+				.setPNext(&semaphore_type_create_info);
+			
+			_semaphore = _device.createSemaphoreUnique(semaphore_create_info, _allocation_callbacks);
+		}
+		
+		TimelineSemaphore::~TimelineSemaphore()
+		{
+		}
+		
+		std::uint64_t TimelineSemaphore::value() const
+		{
+			return _device.getSemaphoreCounterValue(_semaphore.get());
+		}
+		
+		bool TimelineSemaphore::wait(std::uint64_t value, std::uint64_t timeout) const
+		{
+			auto semaphore = _semaphore.get();
+			
+			auto semaphore_wait_info = vk::SemaphoreWaitInfo()
+				.setSemaphoreCount(1)
+				.setPSemaphores(&semaphore)
+				.setPValues(&value);
+			
+			return _device.waitSemaphores(semaphore_wait_info, timeout) == vk::Result::eSuccess;
+		}
+		
+		void TimelineSemaphore::signal(std::uint64_t value)
+		{
+			auto semaphore_signal_info = vk::SemaphoreSignalInfo()
+				.setSemaphore(_semaphore.get())
+				.setValue(value);
+			
+			_device.signalSemaphore(semaphore_signal_info);
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,45 @@
+//
+//  TimelineSemaphore.hpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include <Vizor/GraphicsContext.hpp>
+
+#if defined(VK_VERSION_1_2)
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		// A monotonically increasing counter which is signalled by the GPU. Requires the timelineSemaphore device feature.
+		class TimelineSemaphore : public GraphicsContext
+		{
+		public:
+			TimelineSemaphore(const GraphicsContext & graphics_context, std::uint64_t initial_value = 0);
+			virtual ~TimelineSemaphore();
+			
+			TimelineSemaphore(const TimelineSemaphore &) = delete;
+			
+			vk::Semaphore semaphore() const noexcept {return _semaphore.get();}
+			
+			// The most recent value signalled, i.e. all work up to and including this value has completed.
+			std::uint64_t value() const;
+			
+			// Wait until the counter reaches the given value. Returns false if the timeout expired first.
+			bool wait(std::uint64_t value, std::uint64_t timeout = UINT64_MAX) const;
+			
+			// Set the counter from the host.
+			void signal(std::uint64_t value);
+			
+		protected:
+			vk::UniqueSemaphore _semaphore;
+		};
+	}
+}
+
+#endif
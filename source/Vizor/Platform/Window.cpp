@@ -12,35 +12,14 @@
 #include <vulkan/vulkan_macos.h>
 #endif
 
-#include <Logger/Console.hpp>
-#include <Streams/Container.hpp>
-#include <Streams/Safe.hpp>
-
 namespace Vizor
 {
 	namespace Platform
 	{
-		using namespace Logger;
-		
 		Window::~Window()
 		{
 		}
 		
-		vk::SurfaceKHR Window::surface()
-		{
-			if (!_surface) {
-				Console::info("setup_surface()");
-				setup_surface();
-				Console::info("setup_surface() ->", _surface.get());
-			}
-			
-			return _surface.get();
-		}
-		
-		void Window::prepare(Layers & layers, Extensions & extensions) const noexcept
-		{
-		}
-		
 		void Window::setup_surface()
 		{
 #if defined(VK_USE_PLATFORM_MACOS_MVK)
@@ -8,8 +8,9 @@
 
 #pragma once
 
+#include "Surface.hpp"
+
 #include <Display/Native.hpp>
-#include <Vizor/Context.hpp>
 
 namespace Vizor
 {
@@ -17,21 +18,15 @@ namespace Vizor
 	{
 		using namespace Display;
 		
-		class Window : public Context, public Native::Window
+		class Window : public Surface, public Native::Window
 		{
 		public:
 			template<typename... Args>
-			Window(const Context & context, Args&&... args) : Context(context), Native::Window(std::forward<Args>(args)...) {}
+			Window(const Context & context, Args&&... args) : Surface(context), Native::Window(std::forward<Args>(args)...) {}
 			virtual ~Window();
 			
-			vk::SurfaceKHR surface();
-			
-			virtual void prepare(Layers & layers, Extensions & extensions) const noexcept;
-			
 		protected:
-			void setup_surface();
-			
-			vk::UniqueSurfaceKHR _surface;
+			virtual void setup_surface() override;
 		};
 	}
 }
@@ -0,0 +1,74 @@
+//
+//  WorkerPool.cpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "WorkerPool.hpp"
+
+#include <algorithm>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		WorkerPool::WorkerPool(std::size_t count)
+		{
+			if (count == 0) {
+				count = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+			}
+			
+			_threads.reserve(count);
+			
+			for (std::size_t index = 0; index < count; index += 1) {
+				_threads.emplace_back(&WorkerPool::run, this);
+			}
+		}
+		
+		WorkerPool::~WorkerPool()
+		{
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				_stopping = true;
+			}
+			
+			_condition.notify_all();
+			
+			for (auto & thread : _threads) {
+				thread.join();
+			}
+		}
+		
+		void WorkerPool::enqueue(std::function<void()> task)
+		{
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				_tasks.push_back(std::move(task));
+			}
+			
+			_condition.notify_one();
+		}
+		
+		void WorkerPool::run()
+		{
+			while (true) {
+				std::function<void()> task;
+				
+				{
+					std::unique_lock<std::mutex> lock(_mutex);
+					
+					_condition.wait(lock, [&]{return _stopping || !_tasks.empty();});
+					
+					if (_tasks.empty()) return;
+					
+					task = std::move(_tasks.front());
+					_tasks.pop_front();
+				}
+				
+				task();
+			}
+		}
+	}
+}
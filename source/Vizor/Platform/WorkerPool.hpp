@@ -0,0 +1,67 @@
+//
+//  WorkerPool.hpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		// A fixed set of threads which run tasks in the order they were submitted.
+		class WorkerPool
+		{
+		public:
+			// A count of zero uses one thread per hardware thread.
+			WorkerPool(std::size_t count = 0);
+			
+			// Finishes all outstanding tasks before joining the threads.
+			~WorkerPool();
+			
+			WorkerPool(const WorkerPool &) = delete;
+			
+			std::size_t size() const noexcept {return _threads.size();}
+			
+			template <typename FunctionT>
+			auto async(FunctionT && function) -> std::future<std::invoke_result_t<FunctionT>>
+			{
+				using Result = std::invoke_result_t<FunctionT>;
+				
+				// std::function requires a copyable target, but packaged tasks can only be moved:
+				auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<FunctionT>(function));
+				auto future = task->get_future();
+				
+				enqueue([task]{(*task)();});
+				
+				return future;
+			}
+			
+		protected:
+			void enqueue(std::function<void()> task);
+			void run();
+			
+		private:
+			std::mutex _mutex;
+			std::condition_variable _condition;
+			
+			std::deque<std::function<void()>> _tasks;
+			bool _stopping = false;
+			
+			std::vector<std::thread> _threads;
+		};
+	}
+}
@@ -57,6 +57,20 @@ define_target 'vizor-platform-test' do |target|
 	end
 end
 
+define_target 'vizor-platform-benchmark' do |target|
+	target.depends 'Library/Vizor/Platform'
+	
+	target.depends 'Language/C++17'
+	
+	target.provides 'Benchmark/Vizor/Platform' do |*arguments|
+		benchmark_root = target.package.path + 'benchmark'
+		
+		executable_path = build executable: 'VizorPlatformBenchmark', source_files: benchmark_root.glob('Vizor/Platform/**/*.cpp')
+		
+		run executable: executable_path, arguments: arguments
+	end
+end
+
 # Configurations
 
 define_configuration 'development' do |configuration|
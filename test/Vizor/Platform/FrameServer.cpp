@@ -0,0 +1,148 @@
+//
+//  FrameServer.cpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Vizor/Platform/FrameServer.hpp>
+
+#if defined(__linux__)
+
+#include <cstring>
+#include <string>
+
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		// A minimal client, as an encoder process would implement it.
+		struct FrameClient
+		{
+			int socket = -1;
+			int memory = -1;
+			
+			FrameClient(const std::string & path)
+			{
+				sockaddr_un address = {};
+				address.sun_family = AF_UNIX;
+				std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+				
+				socket = ::socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+				::connect(socket, reinterpret_cast<sockaddr *>(&address), sizeof(address));
+			}
+			
+			~FrameClient()
+			{
+				if (memory != -1) ::close(memory);
+				::close(socket);
+			}
+			
+			FrameServer::Message receive()
+			{
+				FrameServer::Message message = {};
+				iovec iov = {&message, sizeof(message)};
+				
+				union {
+					cmsghdr align;
+					char buffer[CMSG_SPACE(sizeof(int))];
+				} control = {};
+				
+				msghdr header = {};
+				header.msg_iov = &iov;
+				header.msg_iovlen = 1;
+				header.msg_control = control.buffer;
+				header.msg_controllen = sizeof(control.buffer);
+				
+				::recvmsg(socket, &header, 0);
+				
+				if (auto cmsg = CMSG_FIRSTHDR(&header)) {
+					std::memcpy(&memory, CMSG_DATA(cmsg), sizeof(int));
+				}
+				
+				return message;
+			}
+			
+			void release(std::uint32_t slot)
+			{
+				FrameServer::Message message = {};
+				message.type = FrameServer::MessageType::RELEASE;
+				message.slot = slot;
+				
+				::send(socket, &message, sizeof(message), 0);
+			}
+		};
+		
+		// Unique to this process, so that concurrent test runs don't remove each other's sockets.
+		static std::string test_socket_path()
+		{
+			return "/tmp/vizor-frame-server-test-" + std::to_string(::getpid()) + ".sock";
+		}
+		
+		UnitTest::Suite FrameServerTestSuite {
+			"Vizor::Platform::FrameServer",
+			
+			{"it should share frames with clients through memory",
+				[](UnitTest::Examiner & examiner) {
+					FrameServer frame_server(test_socket_path(), 64, 2);
+					FrameClient frame_client(frame_server.path());
+					
+					frame_server.update();
+					examiner.expect(frame_server.clients()) == 1;
+					
+					auto layout = frame_client.receive();
+					examiner.expect(layout.type == FrameServer::MessageType::LAYOUT) == true;
+					examiner.expect(layout.slot_count) == 2;
+					examiner.expect(frame_client.memory != -1) == true;
+					
+					auto data = static_cast<const char *>(::mmap(nullptr, layout.size, PROT_READ, MAP_SHARED, frame_client.memory, 0));
+					
+					const char pixels[] = "0123456789abcdef";
+					examiner.expect(frame_server.publish({7, 2, 2, 37, pixels, 8, 16})) == true;
+					
+					auto frame = frame_client.receive();
+					examiner.expect(frame.type == FrameServer::MessageType::FRAME) == true;
+					examiner.expect(frame.serial) == 7;
+					examiner.expect(frame.width) == 2;
+					examiner.expect(std::string(data + frame.offset, frame.size)) == "0123456789abcdef";
+					
+					::munmap(const_cast<char *>(data), layout.size);
+				}
+			},
+			
+			{"it should drop frames until slots are released",
+				[](UnitTest::Examiner & examiner) {
+					FrameServer frame_server(test_socket_path(), 16, 2);
+					
+					const char pixels[16] = {};
+					examiner.expect(frame_server.publish({1, 2, 2, 37, pixels, 8, 16})) == false;
+					
+					FrameClient frame_client(frame_server.path());
+					frame_server.update();
+					frame_client.receive();
+					
+					examiner.expect(frame_server.publish({2, 2, 2, 37, pixels, 8, 16})) == true;
+					examiner.expect(frame_server.publish({3, 2, 2, 37, pixels, 8, 16})) == true;
+					examiner.expect(frame_server.publish({4, 2, 2, 37, pixels, 8, 16})) == false;
+					examiner.expect(frame_server.dropped()) == 1;
+					
+					auto frame = frame_client.receive();
+					frame_client.release(frame.slot);
+					
+					examiner.expect(frame_server.publish({5, 2, 2, 37, pixels, 8, 16})) == true;
+					examiner.expect(frame_server.published()) == 3;
+				}
+			},
+		};
+	}
+}
+
+#endif
@@ -0,0 +1,72 @@
+//
+//  FrameTrace.cpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Vizor/Platform/FrameTrace.hpp>
+
+#include <sstream>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		UnitTest::Suite FrameTraceTestSuite {
+			"Vizor::Platform::FrameTrace",
+			
+			{"it should keep only the most recent spans",
+				[](UnitTest::Examiner & examiner) {
+					FrameTrace frame_trace(4);
+					
+					for (std::uint64_t frame = 1; frame <= 6; frame += 1) {
+						frame_trace.record("frame", frame, frame * 1000, frame * 2000);
+					}
+					
+					auto spans = frame_trace.spans();
+					
+					examiner.expect(spans.size()) == 4;
+					examiner.expect(spans.front().frame) == 3;
+					examiner.expect(spans.back().frame) == 6;
+				}
+			},
+			
+			{"it should compute percentiles of span durations",
+				[](UnitTest::Examiner & examiner) {
+					FrameTrace frame_trace;
+					
+					for (std::uint64_t frame = 1; frame <= 100; frame += 1) {
+						frame_trace.record("frame", frame, 0, frame * 1000);
+						frame_trace.record("submit", frame, 0, 1);
+					}
+					
+					examiner.expect(frame_trace.percentile("frame", 0.0)) == 1000;
+					examiner.expect(frame_trace.percentile("frame", 0.5)) == 51000;
+					examiner.expect(frame_trace.percentile("frame", 0.99)) == 99000;
+					examiner.expect(frame_trace.percentile("frame", 1.0)) == 100000;
+					examiner.expect(frame_trace.percentile("present", 0.5)) == 0;
+				}
+			},
+			
+			{"it should write chrome trace events",
+				[](UnitTest::Examiner & examiner) {
+					FrameTrace frame_trace;
+					
+					frame_trace.record({"render pass", 7, 1500, 4000, FrameTrace::GPU_TRACK});
+					
+					std::stringstream output;
+					frame_trace.write(output);
+					
+					auto json = output.str();
+					
+					examiner.expect(json.find("\"traceEvents\"") != std::string::npos) == true;
+					examiner.expect(json.find("{\"name\":\"render pass\",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":1.500,\"dur\":2.500,\"args\":{\"frame\":7}}") != std::string::npos) == true;
+				}
+			},
+		};
+	}
+}
@@ -0,0 +1,101 @@
+//
+//  PipelineCache.cpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Vizor/Platform/PipelineCache.hpp>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		static void write_uint32(std::vector<std::uint8_t> & data, std::uint32_t value)
+		{
+			for (std::size_t index = 0; index < 4; index += 1) {
+				data.push_back((value >> (index * 8)) & 0xFF);
+			}
+		}
+		
+		// A pipeline cache header as a driver would write it, followed by some opaque data.
+		static std::vector<std::uint8_t> make_header(const vk::PhysicalDeviceProperties & properties, std::uint32_t header_length = 16 + VK_UUID_SIZE)
+		{
+			std::vector<std::uint8_t> data;
+			
+			write_uint32(data, header_length);
+			write_uint32(data, VK_PIPELINE_CACHE_HEADER_VERSION_ONE);
+			write_uint32(data, properties.vendorID);
+			write_uint32(data, properties.deviceID);
+			data.insert(data.end(), &properties.pipelineCacheUUID[0], &properties.pipelineCacheUUID[0] + VK_UUID_SIZE);
+			
+			data.resize(data.size() + 64, 0xAB);
+			
+			return data;
+		}
+		
+		static vk::PhysicalDeviceProperties make_properties(std::uint8_t uuid)
+		{
+			vk::PhysicalDeviceProperties properties;
+			
+			properties.vendorID = 0x10DE;
+			properties.deviceID = 0x1234;
+			
+			for (std::size_t index = 0; index < VK_UUID_SIZE; index += 1) {
+				properties.pipelineCacheUUID[index] = uuid + index;
+			}
+			
+			return properties;
+		}
+		
+		UnitTest::Suite PipelineCacheTestSuite {
+			"Vizor::Platform::PipelineCache",
+			
+			{"it should accept data written by the same device and driver",
+				[](UnitTest::Examiner & examiner) {
+					auto properties = make_properties(1);
+					
+					examiner.expect(PipelineCache::validate(make_header(properties), properties)) == true;
+				}
+			},
+			
+			{"it should reject data written by a different device or driver",
+				[](UnitTest::Examiner & examiner) {
+					auto properties = make_properties(1);
+					auto data = make_header(properties);
+					
+					examiner.expect(PipelineCache::validate(data, make_properties(2))) == false;
+					
+					auto other_device = properties;
+					other_device.deviceID += 1;
+					examiner.expect(PipelineCache::validate(data, other_device)) == false;
+					
+					auto other_vendor = properties;
+					other_vendor.vendorID += 1;
+					examiner.expect(PipelineCache::validate(data, other_vendor)) == false;
+				}
+			},
+			
+			{"it should reject truncated or malformed headers",
+				[](UnitTest::Examiner & examiner) {
+					auto properties = make_properties(1);
+					auto data = make_header(properties);
+					
+					examiner.expect(PipelineCache::validate({}, properties)) == false;
+					examiner.expect(PipelineCache::validate(std::vector<std::uint8_t>(data.begin(), data.begin() + 20), properties)) == false;
+					
+					// The header length can't be shorter than the fields it contains, or longer than the data:
+					examiner.expect(PipelineCache::validate(make_header(properties, 8), properties)) == false;
+					examiner.expect(PipelineCache::validate(make_header(properties, 4096), properties)) == false;
+					
+					auto other_version = data;
+					other_version[4] = 2;
+					examiner.expect(PipelineCache::validate(other_version, properties)) == false;
+				}
+			},
+		};
+	}
+}
@@ -0,0 +1,73 @@
+//
+//  PresentPolicy.cpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Vizor/Platform/PresentPolicy.hpp>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		using M = vk::PresentModeKHR;
+		
+		UnitTest::Suite PresentPolicyTestSuite {
+			"Vizor::Platform::PresentPolicy",
+			
+			{"it should fall back to FIFO",
+				[](UnitTest::Examiner & examiner) {
+					PresentPolicy present_policy(PresentPolicy::Mode::LOW_LATENCY);
+					
+					examiner.expect(present_policy.select_present_mode({M::eFifo})) == M::eFifo;
+					examiner.expect(present_policy.select_present_mode({M::eFifo, M::eMailbox})) == M::eMailbox;
+					examiner.expect(present_policy.select_present_mode({M::eFifo, M::eMailbox, M::eImmediate})) == M::eImmediate;
+				}
+			},
+			
+			{"it should not tear by default",
+				[](UnitTest::Examiner & examiner) {
+					PresentPolicy present_policy;
+					
+					examiner.expect(present_policy.select_present_mode({M::eFifo, M::eImmediate})) == M::eFifo;
+					examiner.expect(present_policy.select_present_mode({M::eFifo, M::eMailbox, M::eImmediate})) == M::eMailbox;
+				}
+			},
+			
+			{"it should prefer FIFO when saving power",
+				[](UnitTest::Examiner & examiner) {
+					PresentPolicy present_policy(PresentPolicy::Mode::POWER_SAVING);
+					
+					examiner.expect(present_policy.select_present_mode({M::eMailbox, M::eImmediate, M::eFifo})) == M::eFifo;
+				}
+			},
+			
+			{"it should clamp the image count to the surface capabilities",
+				[](UnitTest::Examiner & examiner) {
+					auto surface_capabilities = vk::SurfaceCapabilitiesKHR()
+						.setMinImageCount(3)
+						.setMaxImageCount(4);
+					
+					examiner.expect(PresentPolicy(PresentPolicy::Mode::LOW_LATENCY).select_image_count(surface_capabilities)) == 3;
+					examiner.expect(PresentPolicy(PresentPolicy::Mode::MAX_THROUGHPUT).select_image_count(surface_capabilities)) == 4;
+					examiner.expect(PresentPolicy(M::eImmediate, 8).select_image_count(surface_capabilities)) == 4;
+				}
+			},
+			
+			{"it should use two images for low latency if possible",
+				[](UnitTest::Examiner & examiner) {
+					auto surface_capabilities = vk::SurfaceCapabilitiesKHR()
+						.setMinImageCount(2)
+						.setMaxImageCount(0);
+					
+					examiner.expect(PresentPolicy(PresentPolicy::Mode::LOW_LATENCY).select_image_count(surface_capabilities)) == 2;
+					examiner.expect(PresentPolicy(M::eMailbox).select_image_count(surface_capabilities)) == 3;
+				}
+			},
+		};
+	}
+}
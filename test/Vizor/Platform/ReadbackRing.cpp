@@ -0,0 +1,123 @@
+//
+//  ReadbackRing.cpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Vizor/Platform/ReadbackRing.hpp>
+
+#include <stdexcept>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		static void record(ReadbackRing & ring, std::uint64_t serial)
+		{
+			auto index = ring.reserve();
+			
+			if (index != ReadbackRing::NONE) {
+				ring.commit(index, serial);
+			}
+		}
+		
+		UnitTest::Suite ReadbackRingTestSuite {
+			"Vizor::Platform::ReadbackRing",
+			
+			{"it should deliver slots in order once their frame has completed",
+				[](UnitTest::Examiner & examiner) {
+					ReadbackRing ring(3);
+					std::vector<std::size_t> delivered;
+					auto deliver = [&](std::size_t index){delivered.push_back(index);};
+					
+					record(ring, 1);
+					record(ring, 2);
+					record(ring, 3);
+					
+					examiner.expect(ring.collect(0, deliver)) == 0;
+					
+					examiner.expect(ring.collect(2, deliver)) == 2;
+					examiner.expect(delivered == std::vector<std::size_t>{0, 1}) == true;
+					
+					examiner.expect(ring.collect(3, deliver)) == 1;
+					examiner.expect(delivered == std::vector<std::size_t>{0, 1, 2}) == true;
+					
+					examiner.expect(ring.recorded()) == 3;
+					examiner.expect(ring.delivered()) == 3;
+					examiner.expect(ring.dropped()) == 0;
+				}
+			},
+			
+			{"it should drop frames while every slot is pending",
+				[](UnitTest::Examiner & examiner) {
+					ReadbackRing ring(2);
+					std::vector<std::size_t> delivered;
+					auto deliver = [&](std::size_t index){delivered.push_back(index);};
+					
+					record(ring, 1);
+					record(ring, 2);
+					
+					// Frame 3 has nowhere to go, so it is dropped rather than waiting:
+					examiner.expect(ring.reserve()) == ReadbackRing::NONE;
+					examiner.expect(ring.dropped()) == 1;
+					
+					// Once the oldest slot is delivered, it is reused for the next frame:
+					ring.collect(1, deliver);
+					
+					examiner.expect(ring.reserve()) == 0;
+					ring.commit(0, 4);
+					
+					// Delivery continues in order, wrapping around the ring:
+					examiner.expect(ring.collect(4, deliver)) == 2;
+					examiner.expect(delivered == std::vector<std::size_t>{0, 1, 0}) == true;
+					
+					examiner.expect(ring.recorded()) == 3;
+					examiner.expect(ring.delivered()) == 3;
+				}
+			},
+			
+			{"it should not deliver past a frame which hasn't completed",
+				[](UnitTest::Examiner & examiner) {
+					ReadbackRing ring(3);
+					std::size_t count = 0;
+					
+					record(ring, 5);
+					record(ring, 6);
+					
+					examiner.expect(ring.collect(5, [&](std::size_t){count += 1;})) == 1;
+					examiner.expect(ring.collect(5, [&](std::size_t){count += 1;})) == 0;
+					examiner.expect(count) == 1;
+				}
+			},
+			
+			{"it should reject an empty ring and unreserved slots",
+				[](UnitTest::Examiner & examiner) {
+					bool thrown = false;
+					
+					try {
+						ReadbackRing ring(0);
+					} catch (std::invalid_argument &) {
+						thrown = true;
+					}
+					
+					examiner.expect(thrown) == true;
+					
+					ReadbackRing ring(2);
+					thrown = false;
+					
+					try {
+						ring.commit(1, 1);
+					} catch (std::logic_error &) {
+						thrown = true;
+					}
+					
+					examiner.expect(thrown) == true;
+				}
+			},
+		};
+	}
+}
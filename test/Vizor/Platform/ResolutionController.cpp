@@ -0,0 +1,148 @@
+//
+//  ResolutionController.cpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Vizor/Platform/ResolutionController.hpp>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		// 60Hz, in nanoseconds:
+		static constexpr std::uint64_t BUDGET = 16'666'667;
+		
+		// Adds the times of consecutive frames, each measured lag frames after it was submitted, as with frames in flight:
+		struct Frames
+		{
+			ResolutionController & resolution_controller;
+			std::uint64_t lag = 0;
+			
+			std::uint64_t serial = 0;
+			
+			bool update(std::uint64_t frame_time)
+			{
+				serial += 1;
+				
+				return resolution_controller.update(serial, frame_time, serial + lag + 1);
+			}
+		};
+		
+		UnitTest::Suite ResolutionControllerTestSuite {
+			"Vizor::Platform::ResolutionController",
+			
+			{"it should scale down when over budget",
+				[](UnitTest::Examiner & examiner) {
+					ResolutionController resolution_controller(BUDGET);
+					Frames frames{resolution_controller};
+					
+					examiner.expect(frames.update(BUDGET * 1.4)) == false;
+					examiner.expect(frames.update(BUDGET * 1.4)) == false;
+					examiner.expect(frames.update(BUDGET * 1.4)) == true;
+					
+					// Enough to bring the frame time back under the headroom threshold in one go:
+					examiner.expect(resolution_controller.scale() <= 0.8f) == true;
+					examiner.expect(resolution_controller.scale() >= 0.7f) == true;
+				}
+			},
+			
+			{"it should not change within the hysteresis band",
+				[](UnitTest::Examiner & examiner) {
+					ResolutionController resolution_controller(BUDGET);
+					Frames frames{resolution_controller};
+					
+					bool changed = false;
+					
+					// Alternating either side of the headroom threshold, but never over budget:
+					for (std::size_t frame = 0; frame < 1000; frame += 1) {
+						changed |= frames.update(frame % 2 ? BUDGET * 0.8 : BUDGET * 0.95);
+					}
+					
+					examiner.expect(changed) == false;
+					examiner.expect(resolution_controller.scale()) == 1.0f;
+				}
+			},
+			
+			{"it should scale up slowly after sustained headroom",
+				[](UnitTest::Examiner & examiner) {
+					ResolutionController resolution_controller(BUDGET, 0.5f, 1.0f, 0.05f);
+					Frames frames{resolution_controller};
+					
+					for (std::size_t frame = 0; frame < 10; frame += 1) {
+						frames.update(BUDGET * 4);
+					}
+					
+					examiner.expect(resolution_controller.scale()) == 0.5f;
+					
+					std::size_t changes = 0;
+					
+					for (std::size_t frame = 0; frame < 150; frame += 1) {
+						changes += frames.update(BUDGET / 2);
+					}
+					
+					// One step per sixty consecutive frames of headroom, once the average has caught up:
+					examiner.expect(changes) == 2;
+					examiner.expect(resolution_controller.scale() > 0.55f) == true;
+					examiner.expect(resolution_controller.scale() < 0.65f) == true;
+				}
+			},
+			
+			{"it should ignore frames rendered before the scale changed",
+				[](UnitTest::Examiner & examiner) {
+					ResolutionController resolution_controller(BUDGET);
+					Frames frames{resolution_controller, 2};
+					
+					frames.update(BUDGET * 4);
+					frames.update(BUDGET * 4);
+					examiner.expect(frames.update(BUDGET * 4)) == true;
+					
+					auto scale = resolution_controller.scale();
+					
+					// The two frames in flight when the scale changed still report the old frame time:
+					examiner.expect(frames.update(BUDGET * 4)) == false;
+					examiner.expect(frames.update(BUDGET * 4)) == false;
+					
+					// Frames rendered at the new scale are within the band, so the scale should stay put:
+					for (std::size_t frame = 0; frame < 10; frame += 1) {
+						examiner.expect(frames.update(BUDGET * 0.9)) == false;
+					}
+					
+					examiner.expect(resolution_controller.scale()) == scale;
+					examiner.expect(resolution_controller.average() < BUDGET) == true;
+				}
+			},
+			
+			{"it should ignore frames which were already added",
+				[](UnitTest::Examiner & examiner) {
+					ResolutionController resolution_controller(BUDGET);
+					
+					resolution_controller.update(1, BUDGET / 2, 2);
+					
+					// The profiler reports the same frame until the next one is collected:
+					for (std::size_t frame = 0; frame < 10; frame += 1) {
+						examiner.expect(resolution_controller.update(1, BUDGET * 4, 2)) == false;
+					}
+					
+					examiner.expect(resolution_controller.average()) == BUDGET / 2;
+					examiner.expect(resolution_controller.scale()) == 1.0f;
+				}
+			},
+			
+			{"it should scale the output extent",
+				[](UnitTest::Examiner & examiner) {
+					ResolutionController resolution_controller(BUDGET, 0.85f, 0.85f);
+					
+					auto extent = resolution_controller.extent({1920, 1080});
+					
+					examiner.expect(extent.width) == 1632;
+					examiner.expect(extent.height) == 918;
+				}
+			},
+		};
+	}
+}
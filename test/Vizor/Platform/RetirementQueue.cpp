@@ -0,0 +1,68 @@
+//
+//  RetirementQueue.cpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Vizor/Platform/RetirementQueue.hpp>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		struct Tracker
+		{
+			Tracker(std::size_t & count) : _count(&count) {}
+			Tracker(Tracker && other) : _count(other._count) {other._count = nullptr;}
+			~Tracker() {if (_count) *_count += 1;}
+			
+			std::size_t * _count;
+		};
+		
+		UnitTest::Suite RetirementQueueTestSuite {
+			"Vizor::Platform::RetirementQueue",
+			
+			{"it should destroy objects once their serial has completed",
+				[](UnitTest::Examiner & examiner) {
+					std::size_t destroyed = 0;
+					RetirementQueue retirement_queue;
+					
+					retirement_queue.advance(1);
+					retirement_queue.retire(Tracker(destroyed));
+					
+					retirement_queue.advance(2);
+					retirement_queue.retire(Tracker(destroyed));
+					
+					retirement_queue.collect(0);
+					examiner.expect(destroyed) == 0;
+					
+					retirement_queue.collect(1);
+					examiner.expect(destroyed) == 1;
+					examiner.expect(retirement_queue.size()) == 1;
+					
+					retirement_queue.collect(2);
+					examiner.expect(destroyed) == 2;
+					examiner.expect(retirement_queue.empty()) == true;
+				}
+			},
+			
+			{"it should destroy everything when cleared",
+				[](UnitTest::Examiner & examiner) {
+					std::size_t destroyed = 0;
+					RetirementQueue retirement_queue;
+					
+					retirement_queue.advance(10);
+					retirement_queue.retire(Tracker(destroyed));
+					retirement_queue.retire(Tracker(destroyed));
+					
+					retirement_queue.clear();
+					examiner.expect(destroyed) == 2;
+				}
+			},
+		};
+	}
+}
@@ -0,0 +1,87 @@
+//
+//  SurfaceSignal.cpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Vizor/Platform/SurfaceSignal.hpp>
+
+#include <chrono>
+#include <thread>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		typedef std::chrono::steady_clock Clock;
+		
+		UnitTest::Suite SurfaceSignalTestSuite {
+			"Vizor::Platform::SurfaceSignal",
+			
+			{"it should block a suspended acquire until the surface changes",
+				[](UnitTest::Examiner & examiner) {
+					SurfaceSignal surface_signal;
+					surface_signal.set_events(true);
+					
+					auto start = Clock::now();
+					
+					// As a window event handler would, once the window is restored:
+					std::thread restore([&]{
+						std::this_thread::sleep_for(std::chrono::milliseconds(50));
+						surface_signal.notify({640, 480});
+					});
+					
+					// With surface events, this would block forever without the notification:
+					examiner.expect(surface_signal.wait()) == true;
+					examiner.expect(Clock::now() - start >= std::chrono::milliseconds(50)) == true;
+					
+					restore.join();
+					
+					// The acquire then resumes with the new extent:
+					vk::Extent2D extent;
+					examiner.expect(surface_signal.take(extent)) == true;
+					examiner.expect(extent.width) == 640u;
+					examiner.expect(extent.height) == 480u;
+					
+					examiner.expect(surface_signal.take(extent)) == false;
+				}
+			},
+			
+			{"it should not block if the surface already changed",
+				[](UnitTest::Examiner & examiner) {
+					SurfaceSignal surface_signal;
+					surface_signal.set_events(true);
+					
+					surface_signal.notify({640, 480});
+					
+					examiner.expect(surface_signal.wait()) == true;
+					examiner.expect(surface_signal.pending()) == true;
+				}
+			},
+			
+			{"it should poll without surface events",
+				[](UnitTest::Examiner & examiner) {
+					SurfaceSignal surface_signal;
+					
+					auto start = Clock::now();
+					
+					examiner.expect(surface_signal.wait()) == false;
+					examiner.expect(Clock::now() - start >= std::chrono::nanoseconds(SurfaceSignal::POLL_INTERVAL)) == true;
+				}
+			},
+			
+			{"it should time out with surface events",
+				[](UnitTest::Examiner & examiner) {
+					SurfaceSignal surface_signal;
+					surface_signal.set_events(true);
+					
+					examiner.expect(surface_signal.wait(10'000'000)) == false;
+				}
+			},
+		};
+	}
+}
@@ -12,8 +12,16 @@
 #include <Vizor/ForwardRenderer.hpp>
 #include <Vizor/Platform/Window.hpp>
 
+#include <Vizor/Platform/DeviceSelector.hpp>
 #include <Vizor/Platform/SurfaceDevice.hpp>
 #include <Vizor/Platform/SwapchainController.hpp>
+#include <Vizor/Platform/FramePresenter.hpp>
+#include <Vizor/Platform/FrameAllocator.hpp>
+#include <Vizor/Platform/ParallelRecorder.hpp>
+#include <Vizor/Platform/FrameProfiler.hpp>
+#include <Vizor/Platform/FrameCounters.hpp>
+#include <Vizor/Platform/PipelineCache.hpp>
+#include <Vizor/Platform/PipelineBuilder.hpp>
 
 #include <Logger/Console.hpp>
 #include <Streams/Safe.hpp>
@@ -25,6 +33,8 @@
 
 #include <URI/File.hpp>
 
+#include <Input/ResizeEvent.hpp>
+
 #include <Numerics/Vector.hpp>
 #include <Numerics/Matrix.hpp>
 #include <Numerics/Transforms.hpp>
@@ -48,13 +58,43 @@ namespace Vizor
 			Numerics::Mat44 view = Numerics::IDENTITY;
 		};
 		
+		// Creates the instance with the newest API version the headers support, so that timeline synchronisation can be used where the device supports it.
+		class VersionedApplication : public Vizor::Application
+		{
+		public:
+			using Vizor::Application::Application;
+			virtual ~VersionedApplication() {}
+			
+#if defined(VK_API_VERSION_1_2)
+			static constexpr std::uint32_t API_VERSION = VK_API_VERSION_1_2;
+#else
+			static constexpr std::uint32_t API_VERSION = VK_API_VERSION_1_0;
+#endif
+			
+		protected:
+			using Vizor::Application::setup_instance;
+			
+			virtual void setup_instance(vk::InstanceCreateInfo & instance_create_info) override
+			{
+				auto application_info = instance_create_info.pApplicationInfo ? *instance_create_info.pApplicationInfo : vk::ApplicationInfo();
+				application_info.setApiVersion(API_VERSION);
+				
+				instance_create_info.setPApplicationInfo(&application_info);
+				
+				Vizor::Application::setup_instance(instance_create_info);
+			}
+		};
+		
 		class ShowWindowApplication : public Native::Application
 		{
 		public:
 			using Native::Application::Application;
 			virtual ~ShowWindowApplication() {}
 			
-			Vizor::Application _application;
+			static constexpr std::size_t FRAMES_IN_FLIGHT = 2;
+			static constexpr std::size_t RECORDING_THREADS = 2;
+			
+			VersionedApplication _application;
 			std::unique_ptr<Window> _window;
 			std::unique_ptr<SurfaceDevice> _surface_device;
 			std::unique_ptr<SwapchainController> _swapchain_controller;
@@ -88,28 +128,25 @@ namespace Vizor
 			}
 			
 			Camera _camera;
-			DeviceBuffer _uniform_buffer;
+			
+			// Each frame writes its own copy of the camera, so it never overwrites one which is still in use by an earlier frame:
+			std::unique_ptr<FrameAllocator> _frame_allocator;
 			
 			void setup_uniform_buffer()
 			{
-				_uniform_buffer = _surface_device->context().make_host_buffer_with(_camera, vk::BufferUsageFlagBits::eUniformBuffer);
-
-				// Store information in the uniform's descriptor
-				_uniform_buffer.descriptor = vk::DescriptorBufferInfo(*_uniform_buffer.buffer, 0, sizeof(_camera));
-			}
-
-			void update_uniform_buffer()
-			{
-				_surface_device->context().write_memory(*_uniform_buffer.memory, (Byte *)&_camera, sizeof(_camera));
+				_frame_allocator = std::make_unique<FrameAllocator>(_surface_device->context(), 64 * 1024, FRAMES_IN_FLIGHT);
 			}
 			
-			vk::UniquePipelineCache _pipeline_cache;
+			std::unique_ptr<PipelineCache> _pipeline_cache;
 			
 			vk::UniqueDescriptorPool _descriptor_pool;
 			vk::UniqueDescriptorSetLayout _descriptor_set_layout;
 			vk::UniquePipelineLayout _pipeline_layout;
 			vk::UniquePipeline _pipeline;
 			
+			std::unique_ptr<PipelineBuilder> _pipeline_builder;
+			std::future<vk::UniquePipeline> _pending_pipeline;
+			
 			vk::UniqueShaderModule _vertex_shader, _fragment_shader;
 			vk::DescriptorSet _descriptor_set;
 			
@@ -135,9 +172,7 @@ namespace Vizor
 				auto context = _surface_device->context();
 				
 				if (!_pipeline_cache) {
-					auto pipeline_cache_create_info = vk::PipelineCacheCreateInfo();
-					
-					_pipeline_cache = _surface_device->device().createPipelineCacheUnique(pipeline_cache_create_info, _application.allocation_callbacks());
+					_pipeline_cache = std::make_unique<PipelineCache>(context, "vizor-platform-test.pipeline-cache");
 				}
 				
 				if (!_vertex_shader) {
@@ -150,57 +185,49 @@ namespace Vizor
 				
 				if (!_descriptor_pool) {
 					_descriptor_pool = context.create_descriptor_pool({
-						vk::DescriptorPoolSize(vk::DescriptorType::eUniformBuffer, 1),
+						vk::DescriptorPoolSize(vk::DescriptorType::eUniformBufferDynamic, 1),
 					}, 1);
 					
 					_descriptor_set_layout = context.create_descriptor_layout({
-						vk::DescriptorSetLayoutBinding(0, vk::DescriptorType::eUniformBuffer, 1, vk::ShaderStageFlagBits::eVertex, nullptr),
+						vk::DescriptorSetLayoutBinding(0, vk::DescriptorType::eUniformBufferDynamic, 1, vk::ShaderStageFlagBits::eVertex, nullptr),
 					});
 					
 					_descriptor_set = context.allocate_descriptor_sets(*_descriptor_pool, {*_descriptor_set_layout}).at(0);
+					
+					// The offset of each frame's camera is given when binding the descriptor set:
+					auto buffer_info = vk::DescriptorBufferInfo(_frame_allocator->buffer(), 0, sizeof(Camera));
+					
+					context.device().updateDescriptorSets({
+						descriptor_set_bind(_descriptor_set, buffer_info, vk::DescriptorType::eUniformBufferDynamic, 0),
+					}, {});
 				}
 				
-				auto buffer_info = vk::DescriptorBufferInfo(*_uniform_buffer.buffer, 0, _uniform_buffer.info.size);
+				std::array set_layouts = {
+					_descriptor_set_layout.get()
+				};
 				
-				context.device().updateDescriptorSets({
-					descriptor_set_bind(_descriptor_set, buffer_info, vk::DescriptorType::eUniformBuffer, 0),
-				}, {});
+				auto layout_create_info = vk::PipelineLayoutCreateInfo()
+					.setSetLayoutCount(set_layouts.size())
+					.setPSetLayouts(set_layouts.data());
+				
+				_pipeline_layout = _surface_device->device().createPipelineLayoutUnique(layout_create_info, _application.allocation_callbacks());
 				
-				auto vertex_shader_stage_create_info = vk::PipelineShaderStageCreateInfo()
-					.setStage(vk::ShaderStageFlagBits::eVertex)
-					.setModule(_vertex_shader.get())
-					.setPName("main");
+				if (!_pipeline_builder) {
+					_pipeline_builder = std::make_unique<PipelineBuilder>(context, _pipeline_cache->pipeline_cache());
+				}
 				
-				auto fragment_shader_stage_create_info = vk::PipelineShaderStageCreateInfo()
-					.setStage(vk::ShaderStageFlagBits::eFragment)
-					.setModule(_fragment_shader.get())
-					.setPName("main");
+				GraphicsPipelineDescription description;
 				
-				vk::PipelineShaderStageCreateInfo shader_stages[] = {
-					vertex_shader_stage_create_info,
-					fragment_shader_stage_create_info
+				description.stages = {
+					{vk::ShaderStageFlagBits::eVertex, _vertex_shader.get()},
+					{vk::ShaderStageFlagBits::eFragment, _fragment_shader.get()},
 				};
 				
-				auto vertex_input_create_info = vk::PipelineVertexInputStateCreateInfo()
-					.setVertexBindingDescriptionCount(0)
-					.setVertexAttributeDescriptionCount(0);
-				
-				auto input_assembly_create_info = vk::PipelineInputAssemblyStateCreateInfo()
+				description.input_assembly
 					.setTopology(vk::PrimitiveTopology::eTriangleStrip)
 					.setPrimitiveRestartEnable(false);
 				
-				auto extent = _swapchain_controller->extent();
-				auto viewport = vk::Viewport(0.0, 0.0, extent.width, extent.height, 0.0, 1.0);
-				
-				auto scissor = vk::Rect2D({0, 0}, extent);
-				
-				auto viewport_state_create_info = vk::PipelineViewportStateCreateInfo()
-					.setViewportCount(1)
-					.setPViewports(&viewport)
-					.setScissorCount(1)
-					.setPScissors(&scissor);
-				
-				auto rasterization_state_create_info = vk::PipelineRasterizationStateCreateInfo()
+				description.rasterization
 					.setDepthClampEnable(false)
 					.setRasterizerDiscardEnable(false)
 					.setPolygonMode(vk::PolygonMode::eFill)
@@ -209,54 +236,39 @@ namespace Vizor
 					.setFrontFace(vk::FrontFace::eClockwise)
 				;
 				
-				auto depth_stencil_state_create_info = vk::PipelineDepthStencilStateCreateInfo()
+				description.depth_stencil
 					.setDepthTestEnable(true)
 					.setDepthWriteEnable(true)
 					.setDepthCompareOp(vk::CompareOp::eLessOrEqual);
-
-				auto multisample_state_create_info = vk::PipelineMultisampleStateCreateInfo()
+				
+				description.multisample
 					.setRasterizationSamples(vk::SampleCountFlagBits::e1)
 					.setSampleShadingEnable(true)
 					.setMinSampleShading(0.25);
-
-				typedef vk::ColorComponentFlagBits C;
-				auto color_blend_attachment_state = vk::PipelineColorBlendAttachmentState()
-					.setColorWriteMask(C::eA | C::eR | C::eG | C::eB)
-					// .setColorBlendOp(vk::BlendOp::eAdd)
-					// .setSrcColorBlendFactor(vk::BlendFactor::eOne)
-					// .setDstColorBlendFactor(vk::BlendFactor::eZero)
-					// .setAlphaBlendOp(vk::BlendOp::eAdd)
-					// .setSrcAlphaBlendFactor(vk::BlendFactor::eOne)
-					// .setDstAlphaBlendFactor(vk::BlendFactor::eDstAlpha)
-					.setBlendEnable(false);
-				
-				auto color_blend_state_create_info = vk::PipelineColorBlendStateCreateInfo()
-					.setBlendConstants({{1.0, 1.0, 1.0, 1.0}})
-					.setAttachmentCount(1).setPAttachments(&color_blend_attachment_state);
 				
-				std::array set_layouts = {
-					_descriptor_set_layout.get()
+				typedef vk::ColorComponentFlagBits C;
+				description.color_blend_attachments = {
+					vk::PipelineColorBlendAttachmentState()
+						.setColorWriteMask(C::eA | C::eR | C::eG | C::eB)
+						.setBlendEnable(false)
 				};
 				
-				auto layout_create_info = vk::PipelineLayoutCreateInfo()
-					.setSetLayoutCount(set_layouts.size())
-					.setPSetLayouts(set_layouts.data());
+				description.blend_constants = {{1.0, 1.0, 1.0, 1.0}};
 				
-				_pipeline_layout = _surface_device->device().createPipelineLayoutUnique(layout_create_info, _application.allocation_callbacks());
+				description.layout = _pipeline_layout.get();
+				description.render_pass = _forward_renderer->render_pass();
 				
-				auto graphics_pipeline_create_info = vk::GraphicsPipelineCreateInfo()
-					.setStageCount(2).setPStages(shader_stages)
-					.setPVertexInputState(&vertex_input_create_info)
-					.setPInputAssemblyState(&input_assembly_create_info)
-					.setPViewportState(&viewport_state_create_info)
-					.setPMultisampleState(&multisample_state_create_info)
-					.setPColorBlendState(&color_blend_state_create_info)
-					.setPRasterizationState(&rasterization_state_create_info)
-					.setPDepthStencilState(&depth_stencil_state_create_info)
-					.setLayout(_pipeline_layout.get())
-					.setRenderPass(_forward_renderer->render_pass());
-
-				_pipeline = _surface_device->device().createGraphicsPipelineUnique(_pipeline_cache.get(), graphics_pipeline_create_info, _application.allocation_callbacks());
+				// The pipeline compiles on a worker thread while the rest of the setup continues:
+				_pending_pipeline = _pipeline_builder->build(std::move(description));
+			}
+			
+			vk::Pipeline pipeline()
+			{
+				if (_pending_pipeline.valid()) {
+					_pipeline = _pending_pipeline.get();
+				}
+				
+				return _pipeline.get();
 			}
 			
 			std::vector<vk::UniqueFramebuffer> _framebuffers;
@@ -267,7 +279,9 @@ namespace Vizor
 				const auto & extent = _swapchain_controller->extent();
 				const auto & buffers = _swapchain_controller->buffers();
 				
-				_depth_buffer = _forward_renderer->make_depth_buffer({extent.width, extent.height, 1});
+				if (!_depth_buffer.view) {
+					_depth_buffer = _forward_renderer->make_depth_buffer({extent.width, extent.height, 1});
+				}
 				
 				_framebuffers.clear();
 				_framebuffers.reserve(buffers.size());
@@ -292,171 +306,144 @@ namespace Vizor
 				}
 			}
 			
-			vk::UniqueCommandPool _command_pool;
-			
-			void create_command_pool()
-			{
-				_command_pool = _surface_device->device().createCommandPoolUnique(
-					vk::CommandPoolCreateInfo()
-						.setQueueFamilyIndex(_surface_device->graphics_queue_family_index())
-						.setFlags(vk::CommandPoolCreateFlagBits::eResetCommandBuffer),
-					_application.allocation_callbacks());
-			}
-			
-			std::vector<vk::UniqueCommandBuffer> _command_buffers;
-			
-			void create_command_buffers()
-			{
-				const auto & buffers = _swapchain_controller->buffers();
-				
-				auto allocate_info = vk::CommandBufferAllocateInfo()
-					.setCommandPool(_command_pool.get())
-					.setLevel(vk::CommandBufferLevel::ePrimary)
-					.setCommandBufferCount(buffers.size())
-				;
-				
-				_command_buffers = _surface_device->device().allocateCommandBuffersUnique(allocate_info);
-			}
-			
-			void prepare_command_buffers()
+			void record_command_buffer(FramePresenter::Frame & frame, const FrameAllocator::Allocation & camera)
 			{
 				std::array clear_values = {
 					vk::ClearValue().setColor(std::array{0.0f, 0.0f, 0.0f, 0.0f}),
 					vk::ClearValue().setDepthStencil({1.0f, 0}),
 				};
 				
-				for (size_t i = 0; i < _command_buffers.size(); i++)
-				{
-					auto & commands = _command_buffers[i];
-					
-					commands->begin(vk::CommandBufferBeginInfo());
-					
-					commands->beginRenderPass(
-						vk::RenderPassBeginInfo()
-							.setRenderPass(_forward_renderer->render_pass())
-							.setFramebuffer(_framebuffers[i].get())
-							.setRenderArea(vk::Rect2D({0, 0}, _swapchain_controller->extent()))
-							.setClearValueCount(clear_values.size()).setPClearValues(clear_values.data()),
-						vk::SubpassContents::eInline
-					);
-					
-					commands->bindDescriptorSets(vk::PipelineBindPoint::eGraphics, *_pipeline_layout, 0, {_descriptor_set}, nullptr);
-					
-					commands->bindPipeline(vk::PipelineBindPoint::eGraphics, _pipeline.get());
+				auto & commands = frame.command_buffer;
+				
+				commands.begin(vk::CommandBufferBeginInfo().setFlags(vk::CommandBufferUsageFlagBits::eOneTimeSubmit));
+				
+				_frame_profiler->begin(frame);
+				auto render_pass_span = _frame_profiler->begin_span(commands, "render pass");
+				
+				// The pass is counted around the secondary command buffers, so they must inherit the query state:
+				auto pass = FrameCounters::NONE;
+				auto inheritance_info = vk::CommandBufferInheritanceInfo();
+				
+				if (_frame_counters) {
+					_frame_counters->begin(frame);
+					pass = _frame_counters->begin_pass(commands, "quads");
+					inheritance_info = _frame_counters->inheritance_info();
+				}
+				
+				commands.beginRenderPass(
+					vk::RenderPassBeginInfo()
+						.setRenderPass(_forward_renderer->render_pass())
+						.setFramebuffer(_framebuffers[frame.image_index].get())
+						.setRenderArea(vk::Rect2D({0, 0}, _swapchain_controller->extent()))
+						.setClearValueCount(clear_values.size()).setPClearValues(clear_values.data()),
+					vk::SubpassContents::eSecondaryCommandBuffers
+				);
+				
+				auto pipeline = this->pipeline();
+				
+				_parallel_recorder->record(frame, _forward_renderer->render_pass(), 0, _framebuffers[frame.image_index].get(), INSTANCES, [&](vk::CommandBuffer commands, std::size_t begin, std::size_t end){
+					commands.bindDescriptorSets(vk::PipelineBindPoint::eGraphics, *_pipeline_layout, 0, {_descriptor_set}, {camera.dynamic_offset()});
 					
-					commands->draw(4, 1, 0, 0);
+					commands.bindPipeline(vk::PipelineBindPoint::eGraphics, pipeline);
 					
-					commands->endRenderPass();
+					commands.setViewport(0, {_swapchain_controller->viewport()});
+					commands.setScissor(0, {_swapchain_controller->scissor()});
 					
-					commands->end();
+					for (std::size_t instance = begin; instance < end; instance += 1) {
+						commands.draw(4, 1, 0, instance);
+					}
+				}, inheritance_info);
+				
+				commands.endRenderPass();
+				
+				if (_frame_counters) {
+					_frame_counters->end_pass(commands, pass);
 				}
+				
+				_frame_profiler->end_span(commands, render_pass_span);
+				
+				commands.end();
 			}
 			
-			static const int MAX_FRAMES_IN_FLIGHT = 2;
+			std::unique_ptr<FramePresenter> _frame_presenter;
 			
-			std::vector<vk::UniqueSemaphore> _image_available;
-			std::vector<vk::UniqueSemaphore> _render_finished;
-			std::vector<vk::UniqueFence> _fences; 
-			size_t _current_frame = 0;
+			// The same quad is drawn several times, to exercise recording across threads:
+			static constexpr std::size_t INSTANCES = 8;
+			std::unique_ptr<ParallelRecorder> _parallel_recorder;
 			
-			void prepare_synchronisation()
+			FrameTrace _frame_trace;
+			std::unique_ptr<FrameProfiler> _frame_profiler;
+			std::unique_ptr<FrameCounters> _frame_counters;
+			
+			void swapchain_changed(const SwapchainController::Changes & changes)
 			{
-				auto semaphore_create_info = vk::SemaphoreCreateInfo();
-				
-				auto fence_create_info = vk::FenceCreateInfo()
-					.setFlags(vk::FenceCreateFlagBits::eSignaled);
-				
-				_image_available.clear();
-				_render_finished.clear();
-				_fences.clear();
-				
-				for (std::size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++)
-				{
-					_image_available.push_back(
-						_surface_device->device().createSemaphoreUnique(semaphore_create_info, _application.allocation_callbacks())
-					);
-					
-					_render_finished.push_back(
-						_surface_device->device().createSemaphoreUnique(semaphore_create_info, _application.allocation_callbacks())
-					);
+				// Frames in flight may still be using these, so retire them rather than waiting for the device to become idle:
+				auto & retirement_queue = _swapchain_controller->retirement_queue();
+				
+				// The pipeline uses dynamic viewport and scissor state, so only a new surface format requires it to be rebuilt:
+				if (changes.surface_format) {
+					retirement_queue.retire(std::move(_pipeline));
+					retirement_queue.retire(std::move(_pipeline_layout));
+					retirement_queue.retire(std::move(_forward_renderer));
 					
-					_fences.push_back(
-						_surface_device->device().createFenceUnique(fence_create_info, _application.allocation_callbacks())
-					);
+					create_render_pass();
+					create_graphics_pipeline();
 				}
-			}
-			
-			void recreate_swapchain()
-			{
-				auto size = _window->layout().bounds.size();
-				vk::Extent2D extent(size[0], size[1]);
 				
-				Console::warn("Resizing swapchain...", Streams::safe(size));
+				if (changes.extent) {
+					retirement_queue.retire(std::move(_depth_buffer));
+				}
 				
-				_current_frame = 0;
-				_swapchain_controller->resize(extent);
+				// Framebuffers refer to the swapchain image views, which are new every time:
+				retirement_queue.retire(std::move(_framebuffers));
 				
-				create_render_pass();
-				setup_uniform_buffer();
-				create_graphics_pipeline();
 				create_framebuffers();
-				// create_command_pool();
-				create_command_buffers();
-				prepare_command_buffers();
-				prepare_synchronisation();
 			}
 			
-			void draw_frame()
+			// Returns false once the surface is lost, as it can't be recovered without recreating it.
+			bool draw_frame()
 			{
-				// Logger::Console::info("draw_frame:", _current_frame);
-				
-				auto device = _surface_device->device();
-				auto fence = _fences[_current_frame].get();
-				
-				device.waitForFences(1, &fence, true, UINT64_MAX);
-				
-				uint32_t image_index;
-				
-				device.acquireNextImageKHR(_swapchain_controller->swapchain(), UINT64_MAX, _image_available[_current_frame].get(), nullptr, &image_index);
-				
-				auto submit_info = vk::SubmitInfo()
-					.setCommandBufferCount(1)
-					.setPCommandBuffers(&_command_buffers[image_index].get());
-				
-				vk::Semaphore wait_semaphores[] = {_image_available[_current_frame].get()};
-				vk::PipelineStageFlags wait_stages[] = {vk::PipelineStageFlagBits::eColorAttachmentOutput};
-				submit_info
-					.setWaitSemaphoreCount(1)
-					.setPWaitSemaphores(wait_semaphores)
-					.setPWaitDstStageMask(wait_stages);
-				
-				vk::Semaphore signal_semaphores[] = {_render_finished[_current_frame].get()};
-				submit_info
-					.setSignalSemaphoreCount(1)
-					.setPSignalSemaphores(signal_semaphores);
-				
-				device.resetFences(1, &fence);
-				
-				_surface_device->graphics_queue().submit(1, &submit_info, fence);
-				
-				auto present_info = vk::PresentInfoKHR()
-					.setWaitSemaphoreCount(1)
-					.setPWaitSemaphores(signal_semaphores);
-				
-				vk::SwapchainKHR swapchains[] = {_swapchain_controller->swapchain()};
-				present_info
-					.setSwapchainCount(1)
-					.setPSwapchains(swapchains)
-					.setPImageIndices(&image_index);
-				
-				_surface_device->present_queue().presentKHR(present_info);
+				// The swapchain is recreated by the presenter when it becomes out of date or suboptimal, so we just skip this frame:
+				if (auto frame = _frame_presenter->acquire()) {
+					_frame_allocator->begin(frame->index);
+					auto camera = _frame_allocator->write(_camera);
+					
+					{
+						FrameTrace::Scope scope(&_frame_trace, "record", frame->serial);
+						record_command_buffer(*frame, camera);
+					}
+					
+					_frame_profiler->end(*frame);
+					_frame_presenter->present(*frame);
+					
+					if (frame->serial % 1000 == 0) {
+						Console::info("Frame time p50:", _frame_trace.percentile("frame", 0.5) / 1000, "us p99:", _frame_trace.percentile("frame", 0.99) / 1000, "us");
+						
+						if (_frame_counters) {
+							for (auto & counters : _frame_counters->counters()) {
+								Console::info("Pass", counters.name, "samples:", counters.samples_passed, "fragment shader invocations:", counters.fragment_shader_invocations);
+							}
+						}
+					}
+				}
 				
-				_current_frame = (_current_frame + 1) % MAX_FRAMES_IN_FLIGHT;
+				return _frame_presenter->status() != FramePresenter::Status::SURFACE_LOST;
 			}
 			
 			Time::Timer _timer;
 			std::thread _renderer;
 			
+			// Window events arrive on this thread, while the renderer may be blocked in acquire() waiting for a minimised window to be restored:
+			virtual bool process(const Input::ResizeEvent & event)
+			{
+				if (_swapchain_controller) {
+					auto size = _window->layout().bounds.size();
+					_swapchain_controller->surface_changed(vk::Extent2D(size[0], size[1]));
+				}
+				
+				return true;
+			}
+			
 			virtual void did_finish_launching()
 			{
 				URI::File fixture_path(getenv("SHADERS_FIXTURES"), true);
@@ -468,8 +455,30 @@ namespace Vizor
 				_window = std::make_unique<Window>(_application.context(), *this);
 				_window->show();
 				
+				// The pipeline uses sample shading, which is no longer enabled implicitly:
+				DeviceFeatures required_features;
+				required_features.core.setSampleRateShading(true);
+				
+				Console::warn("Selecting device...");
+				DeviceSelector device_selector(_application.context(), *_window);
+				device_selector.require_features(required_features);
+				device_selector.set_instance_api_version(VersionedApplication::API_VERSION);
+				
+				// Timeline synchronisation is used where the device supports it:
+				DeviceFeatures optional_features;
+#if defined(VK_VERSION_1_2)
+				optional_features.vulkan12.setTimelineSemaphore(true);
+#endif
+				
+				// Pass counters need inherited queries, as the pass is drawn by secondary command buffers. Statistics and precise sample counts are used if available:
+				optional_features.core.setInheritedQueries(true);
+				optional_features.core.setPipelineStatisticsQuery(true);
+				optional_features.core.setOcclusionQueryPrecise(true);
+				
 				Console::warn("Preparing surface...");
-				_surface_device = std::make_unique<SurfaceDevice>(_application.context(), *_window);
+				_surface_device = std::make_unique<SurfaceDevice>(device_selector.select(), *_window);
+				_surface_device->set_instance_api_version(VersionedApplication::API_VERSION);
+				_surface_device->request_features(required_features, optional_features);
 				
 				SwapchainController::QueueFamilyIndices queue_family_indices = {
 					_surface_device->graphics_queue_family_index(),
@@ -484,6 +493,9 @@ namespace Vizor
 					auto context = _surface_device->context();
 					Console::warn("Preparing swapchain...");
 					_swapchain_controller = std::make_unique<SwapchainController>(context, queue_family_indices, extent);
+					
+					// Resizes are reported by process(), so a suspended renderer doesn't need to poll:
+					_swapchain_controller->set_surface_events(true);
 				} catch (std::runtime_error & error) {
 					Console::error(error.what());
 				} catch (...) {
@@ -500,22 +512,33 @@ namespace Vizor
 				setup_uniform_buffer();
 				create_graphics_pipeline();
 				create_framebuffers();
-				create_command_pool();
-				create_command_buffers();
-				prepare_command_buffers();
-				prepare_synchronisation();
+				
+				auto & enabled_features = _surface_device->enabled_features();
+				auto synchronisation = FramePresenter::supports(FramePresenter::Synchronisation::TIMELINE, enabled_features) ? FramePresenter::Synchronisation::TIMELINE : FramePresenter::Synchronisation::FENCES;
+				
+				Console::warn("Synchronising frames with", synchronisation == FramePresenter::Synchronisation::TIMELINE ? "a timeline semaphore" : "fences");
+				
+				_frame_presenter = std::make_unique<FramePresenter>(*_swapchain_controller, enabled_features, FRAMES_IN_FLIGHT, synchronisation, RECORDING_THREADS);
+				_parallel_recorder = std::make_unique<ParallelRecorder>(RECORDING_THREADS);
+				
+				_frame_presenter->set_trace(&_frame_trace);
+				_frame_profiler = std::make_unique<FrameProfiler>(_surface_device->context(), _surface_device->graphics_queue_family_index(), _frame_trace, FRAMES_IN_FLIGHT);
+				
+				if (enabled_features.core.inheritedQueries) {
+					_frame_counters = std::make_unique<FrameCounters>(_surface_device->context(), enabled_features, FRAMES_IN_FLIGHT);
+				}
+				
+				_swapchain_controller->observe([this](RenderTarget & render_target, const RenderTarget::Changes & changes){
+					swapchain_changed(changes);
+				});
 				
 				_renderer = std::thread([&]{
 					while (true) {
-						try {
-							_camera.model = Numerics::Transforms::rotate(Numerics::radians((double)_timer.time()), Vec3{0, 0, 1});
-							update_uniform_buffer();
-							
-							draw_frame();
-						} catch (vk::OutOfDateKHRError) {
-							Console::warn("Recreate swapchain...");
-							_surface_device->device().waitIdle();
-							recreate_swapchain();
+						_camera.model = Numerics::Transforms::rotate(Numerics::radians((double)_timer.time()), Vec3{0, 0, 1});
+						
+						if (!draw_frame()) {
+							Console::error("Surface lost, stopping renderer!");
+							break;
 						}
 					}
 				});
@@ -0,0 +1,77 @@
+//
+//  WorkerPool.cpp
+//  This file is part of the "Vizor Platform" project and released under the .
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Vizor/Platform/WorkerPool.hpp>
+
+#include <atomic>
+#include <stdexcept>
+
+namespace Vizor
+{
+	namespace Platform
+	{
+		UnitTest::Suite WorkerPoolTestSuite {
+			"Vizor::Platform::WorkerPool",
+			
+			{"it should deliver results through the future",
+				[](UnitTest::Examiner & examiner) {
+					WorkerPool worker_pool(2);
+					
+					examiner.expect(worker_pool.size()) == 2;
+					
+					auto first = worker_pool.async([]{return 10;});
+					auto second = worker_pool.async([]{return 20;});
+					
+					examiner.expect(first.get()) == 10;
+					examiner.expect(second.get()) == 20;
+				}
+			},
+			
+			{"it should rethrow errors from the future",
+				[](UnitTest::Examiner & examiner) {
+					WorkerPool worker_pool(1);
+					
+					auto future = worker_pool.async([]() -> int {
+						throw std::runtime_error("Task failed!");
+					});
+					
+					bool thrown = false;
+					
+					try {
+						future.get();
+					} catch (std::runtime_error &) {
+						thrown = true;
+					}
+					
+					examiner.expect(thrown) == true;
+					
+					// The worker should survive the error:
+					examiner.expect(worker_pool.async([]{return 1;}).get()) == 1;
+				}
+			},
+			
+			{"it should finish queued tasks before being destroyed",
+				[](UnitTest::Examiner & examiner) {
+					std::atomic<std::size_t> count{0};
+					
+					{
+						WorkerPool worker_pool(1);
+						
+						for (std::size_t index = 0; index < 100; index += 1) {
+							worker_pool.async([&]{count += 1;});
+						}
+					}
+					
+					examiner.expect(count.load()) == 100;
+				}
+			},
+		};
+	}
+}